@@ -0,0 +1,260 @@
+/// @file
+
+// INCLUDES:
+#include "config.hpp"                                                                                // Run configuration.
+#include "profiler.hpp"                                                                              // Timing log format.
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <map>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <ctime>
+
+#define BENCH_FILE    "Benchmark_"                                                                   // Benchmark result file name (timestamp to be added).
+#define BENCH_HOME    "../../log/"                                                                   // Benchmark output directory.
+#define BENCH_RUN     "Benchmark_run"                                                                // Benchmark case directory name (case index to be added).
+#define BENCH_COLUMNS "label,device,update,sampler,lattice,nodes,T,m_max,status,first_batch_ms,"      \
+  "sweep_us,sweep_p99_us,sweeps_per_s,updates_per_s,bytes_per_sweep,GB_per_s,iterations_per_node"    // Benchmark CSV header.
+
+int main (
+          int    argc,                                                                               // Number of command line arguments.
+          char** argv                                                                                // Command line arguments.
+         )
+{
+  // CONFIGURATION:
+  sb::config*                           cfg = new sb::config ();                                     // Benchmark configuration.
+
+  // INDICES:
+  size_t                                run;                                                         // Case index [#].
+  size_t                                failed = 0;                                                  // Failed cases [#].
+
+  // BENCHMARK MATRIX:
+  std::vector<std::string>              device;                                                      // OpenCL devices ("gpu", "cpu").
+  std::vector<std::string>              update;                                                      // Update kernels ("csr", "structured", "colour").
+  std::vector<std::string>              sampler;                                                     // Single-site samplers ("heatbath", "rejection").
+  std::vector<std::string>              lattice;                                                     // Lattice sides [#].
+  std::vector<std::string>              T;                                                           // Temperatures.
+  std::vector<std::string>              m_max;                                                       // Maximum allowed numbers of rejections.
+  size_t                                d, u, s, l, t, m;                                            // Matrix indices [#].
+
+  // CASE:
+  std::string                           headless;                                                    // Headless executable.
+  std::string                           base;                                                        // Headless base configuration.
+  std::string                           output;                                                      // Output directory.
+  std::string                           label;                                                       // Build label (e.g. commit), written to every result.
+  std::string                           steps;                                                       // Steps per case.
+  std::string                           readback;                                                    // Readback interval [steps].
+  std::string                           directory;                                                   // Case directory.
+  std::string                           command;                                                     // Case command line.
+  std::string                           status;                                                      // Case status.
+  std::map<std::string, double>         mean;                                                        // Channel means (last timing log line).
+  std::map<std::string, double>         p99;                                                         // Channel p99 (last timing log line).
+  size_t                                side;                                                        // Lattice side [#].
+
+  // TIMING LOG:
+  std::ifstream                         timing;                                                      // Timing log.
+  std::string                           line;                                                        // Timing log line.
+  std::string                           step_text;                                                   // Timing log step.
+  std::string                           channel;                                                     // Timing log channel.
+  size_t                                samples;                                                     // Timing log samples.
+  double                                value_mean;                                                  // Timing log mean.
+  double                                value_p50;                                                   // Timing log p50.
+  double                                value_p99;                                                   // Timing log p99.
+
+  // RESULTS:
+  std::ofstream                         csv;                                                         // CSV results.
+  std::ofstream                         json;                                                        // JSON results.
+  std::string                           timestamp;                                                   // Timestamp.
+  char                                  clock_text[32];                                              // Timestamp text.
+  time_t                                now = time (NULL);                                           // Wall-clock time.
+  double                                rate;                                                        // Sweeps per second.
+
+  // PARSING CONFIGURATION:
+  cfg->parse (argc, argv);                                                                           // Parsing command line (and configuration file)...
+
+  headless = cfg->get ("headless", "./spin-bubble-headless");                                        // Getting headless executable...
+  base     = cfg->get ("base", "../../Code/headless/headless.cfg");                                  // Getting headless base configuration...
+  output   = cfg->get ("output", BENCH_HOME);                                                        // Getting output directory...
+  label    = cfg->get ("label", "");                                                                 // Getting build label...
+  steps    = cfg->get ("steps", "1024");                                                             // Getting steps per case...
+  readback = cfg->get ("readback", "64");                                                            // Getting readback interval...
+  device   = cfg->list ("devices", "gpu, cpu");                                                      // Getting devices...
+  update   = cfg->list ("updates", "csr, structured, colour");                                       // Getting update kernels...
+  sampler  = cfg->list ("samplers", "heatbath, rejection");                                          // Getting samplers...
+  lattice  = cfg->list ("lattices", "256, 512, 1024, 2048");                                         // Getting lattice sides...
+  T        = cfg->list ("T", "0.1");                                                                 // Getting temperatures...
+  m_max    = cfg->list ("m_max", "1000");                                                            // Getting maximum allowed numbers of rejections...
+
+  if(device.empty () || update.empty () || sampler.empty () || lattice.empty () || T.empty () || m_max.empty ())
+  {
+    std::cerr << "Error: empty benchmark matrix." << std::endl;                                      // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////// OPENING RESULT FILES ////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  strftime (clock_text, sizeof (clock_text), "%Y-%m-%d_%H-%M-%S", localtime (&now));                 // Formatting timestamp...
+  timestamp = clock_text;                                                                            // Getting timestamp...
+  std::filesystem::create_directories (output);                                                      // Creating output directory...
+  csv.open (output + BENCH_FILE + timestamp + ".csv");                                               // Opening CSV results...
+  json.open (output + BENCH_FILE + timestamp + ".json");                                             // Opening JSON results...
+
+  if(!csv.is_open () || !json.is_open ())
+  {
+    std::cerr << "Error: cannot create benchmark results in " << output << std::endl;                // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  csv << BENCH_COLUMNS << std::endl;                                                                 // Writing CSV header...
+  json << "[" << std::endl;                                                                          // Opening JSON array...
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////////// BENCHMARK LOOP //////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  // One headless process per case: Neutrino binds all buffers to one OpenCL context per process.
+  run = 0;                                                                                           // Resetting case index...
+
+  for(d = 0; d < device.size (); d++)
+  {
+    for(u = 0; u < update.size (); u++)
+    {
+      for(s = 0; s < sampler.size (); s++)
+      {
+        for(l = 0; l < lattice.size (); l++)
+        {
+          for(t = 0; t < T.size (); t++)
+          {
+            for(m = 0; m < m_max.size (); m++)
+            {
+              // Skipping m_max values with the heat-bath sampler (m_max only bounds its iterations):
+              if((sampler[s] == "heatbath") && (m > 0))
+              {
+                continue;
+              }
+
+              // SETTING CASE:
+              side      = std::stoul (lattice[l]);                                                   // Getting lattice side...
+              directory = output + BENCH_RUN + std::to_string (run) + "/";                           // Setting case directory...
+              std::filesystem::remove_all (directory);                                               // Removing previous case results...
+              std::filesystem::create_directories (directory);                                       // Creating case directory...
+
+              command   = headless +
+                          " --config " + base +
+                          " --device " + device[d] +
+                          " --update " + ((update[u] == "colour") ? "colour" : "jacobi") +
+                          " --structured " + ((update[u] == "structured") ? "auto" : "off") +
+                          " --sampler " + sampler[s] +
+                          " --lattice_x " + lattice[l] +
+                          " --lattice_y " + lattice[l] +
+                          " --T " + T[t] +
+                          " --m_max " + m_max[m] +
+                          " --steps " + steps +
+                          " --readback " + readback +
+                          " --trials 1 --replicas 1 --tempering false --seed 1 --profile true" +
+                          " --output " + directory +
+                          " > " + directory + "stdout.txt 2>&1";                                     // Setting case command line...
+
+              std::cout << "case " << run << ": " << device[d] << ", " << update[u] << ", " << sampler[s]
+                        << ", " << side << " x " << side << ", T = " << T[t] << ", m_max = " << m_max[m]
+                        << "..." << std::endl;                                                       // Printing message...
+
+              // RUNNING CASE:
+              status = (std::system (command.c_str ()) == 0) ? "ok" : "failed";                      // Running headless process...
+              mean.clear ();                                                                         // Resetting channel means...
+              p99.clear ();                                                                          // Resetting channel p99...
+
+              // READING TIMING LOG (last line of each channel):
+              for(auto& entry : std::filesystem::directory_iterator (directory))
+              {
+                if(entry.path ().filename ().string ().compare (0, std::string (PROFILE_FILE).size (),
+                                                                PROFILE_FILE) != 0)
+                {
+                  continue;
+                }
+
+                timing.open (entry.path ());                                                         // Opening timing log...
+
+                while(std::getline (timing, line))
+                {
+                  std::istringstream fields (line);                                                  // Timing log fields.
+
+                  if(line.empty () || (line[0] == '#'))
+                  {
+                    continue;
+                  }
+
+                  std::getline (fields, step_text, '\t');                                            // Getting step...
+                  std::getline (fields, channel, '\t');                                              // Getting channel...
+
+                  if(fields >> samples >> value_mean >> value_p50 >> value_p99)
+                  {
+                    mean[channel] = value_mean;                                                      // Setting channel mean...
+                    p99[channel]  = value_p99;                                                       // Setting channel p99...
+                  }
+                }
+
+                timing.close ();                                                                     // Closing timing log...
+              }
+
+              if((status == "ok") && (mean.count ("sweeps/s") == 0))
+              {
+                status = "no timing";                                                                // Setting status (no readback)...
+              }
+
+              if(status != "ok")
+              {
+                std::cerr << "Warning: case " << run << " " << status << ", see " << directory
+                          << "stdout.txt" << std::endl;                                              // Printing message...
+                failed++;                                                                            // Updating failed cases...
+              }
+
+              // WRITING RESULTS (sweep time: blocking kernel launches per sweep, see profiler.hpp):
+              rate = mean["sweeps/s"];                                                               // Getting sweeps per second...
+
+              csv << label << "," << device[d] << "," << update[u] << "," << sampler[s] << ","
+                  << side << "," << side*side << "," << T[t] << "," << m_max[m] << "," << status << ","
+                  << mean["first batch"]/1000.0 << "," << mean["sweep"] << "," << p99["sweep"] << ","
+                  << rate << "," << mean["updates/s"] << "," << mean["bytes/sweep"] << ","
+                  << mean["bytes/sweep"]*rate/1.0e9 << "," << mean["iterations/node"] << std::endl;  // Writing CSV line...
+
+              json << ((run > 0) ? ",\n" : "") << "  {\"label\": \"" << label << "\", \"device\": \""
+                   << device[d] << "\", \"update\": \"" << update[u] << "\", \"sampler\": \"" << sampler[s]
+                   << "\", \"lattice\": " << side << ", \"nodes\": " << side*side << ", \"T\": " << T[t]
+                   << ", \"m_max\": " << m_max[m] << ", \"status\": \"" << status
+                   << "\", \"first_batch_ms\": " << mean["first batch"]/1000.0
+                   << ", \"sweep_us\": " << mean["sweep"] << ", \"sweep_p99_us\": " << p99["sweep"]
+                   << ", \"sweeps_per_s\": " << rate << ", \"updates_per_s\": " << mean["updates/s"]
+                   << ", \"bytes_per_sweep\": " << mean["bytes/sweep"]
+                   << ", \"GB_per_s\": " << mean["bytes/sweep"]*rate/1.0e9
+                   << ", \"iterations_per_node\": " << mean["iterations/node"] << "}";               // Writing JSON object...
+
+              run++;                                                                                 // Updating case index...
+            }
+          }
+        }
+      }
+    }
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////// CLOSING RESULT FILES ////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  json << std::endl << "]" << std::endl;                                                             // Closing JSON array...
+  csv.close ();                                                                                      // Closing CSV results...
+  json.close ();                                                                                     // Closing JSON results...
+
+  std::cout << run << " cases, " << failed << " failed: results in " << output << BENCH_FILE << timestamp
+            << ".csv/.json" << std::endl;                                                            // Printing message...
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  /////////////////////////////////////////////// CLEANUP ////////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  delete cfg;                                                                                        // Deleting configuration...
+
+  return (failed > 0) ? EXIT_FAILURE : 0;
+}
@@ -0,0 +1,57 @@
+/// @file     angle.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the 16-bit fixed-point angles.
+/// @details  Compiles the kernel source (Code/kernel/angle.cl) as C++, with the float overload of
+/// the OpenCL C "rint" it calls, and packs/unpacks host arrays two angles per 32-bit word.
+
+#include "angle.hpp"
+
+#include <cmath>
+#include <cstring>
+
+namespace sb
+{
+using std::rint;
+
+#include "../kernel/angle.cl"
+}
+
+size_t sb::packed_size (
+                        size_t loc_size                                                              // Number of values [#].
+                       )
+{
+  return (loc_size + 1)/2;
+}
+
+void sb::pack_angles (
+                      const std::vector<float>& loc_theta,                                           // Theta [rad].
+                      std::vector<int>&         loc_packed                                           // Packed angles.
+                     )
+{
+  std::vector<sb::ushort> a (2*packed_size (loc_theta.size ()), 0);                                  // Fixed-point angles.
+  size_t                  i;                                                                         // Angle index [#].
+
+  for(i = 0; i < loc_theta.size (); i++)
+  {
+    a[i] = sb::angle_encode (loc_theta[i]);                                                          // Encoding angle...
+  }
+
+  loc_packed.resize (packed_size (loc_theta.size ()));                                               // Sizing packed angles...
+  std::memcpy (loc_packed.data (), a.data (), a.size ()*sizeof (sb::ushort));                        // Packing angles...
+}
+
+void sb::unpack_angles (
+                        const std::vector<int>& loc_packed,                                          // Packed angles.
+                        std::vector<float>&     loc_theta                                            // Theta [rad].
+                       )
+{
+  std::vector<sb::ushort> a (2*loc_packed.size ());                                                  // Fixed-point angles.
+  size_t                  i;                                                                         // Angle index [#].
+
+  std::memcpy (a.data (), loc_packed.data (), a.size ()*sizeof (sb::ushort));                        // Unpacking angles...
+
+  for(i = 0; (i < loc_theta.size ()) && (i < a.size ()); i++)
+  {
+    loc_theta[i] = sb::angle_decode (a[i]);                                                          // Decoding angle...
+  }
+}
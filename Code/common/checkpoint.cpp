@@ -0,0 +1,180 @@
+/// @file     checkpoint.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the "checkpoint" class.
+
+#include "checkpoint.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cstdlib>
+#include <cstdint>
+#include <cstdio>
+
+sb::checkpoint::checkpoint ()
+{
+  // Doing nothing!
+}
+
+void sb::checkpoint::set (
+                          std::string loc_key,                                                       // Section name.
+                          const void* loc_data,                                                      // Section data.
+                          size_t      loc_size                                                       // Section size [bytes].
+                         )
+{
+  const char* byte = (const char*)loc_data;                                                          // Section bytes.
+
+  section[loc_key].assign (byte, byte + loc_size);                                                   // Setting section...
+}
+
+void sb::checkpoint::get (
+                          std::string loc_key,                                                       // Section name.
+                          void*       loc_data,                                                      // Section data.
+                          size_t      loc_size                                                       // Section size [bytes].
+                         )
+{
+  if(!has (loc_key))
+  {
+    std::cerr << "Error: checkpoint has no \"" << loc_key << "\" section." << std::endl;             // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  if(section[loc_key].size () != loc_size)
+  {
+    std::cerr << "Error: checkpoint \"" << loc_key << "\" section does not match the run ("
+              << section[loc_key].size () << " bytes instead of " << loc_size << ")." << std::endl;  // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  std::memcpy (loc_data, section[loc_key].data (), loc_size);                                        // Getting section...
+}
+
+bool sb::checkpoint::has (
+                          std::string loc_key                                                        // Section name.
+                         )
+{
+  return section.find (loc_key) != section.end ();
+}
+
+size_t sb::checkpoint::size (
+                             std::string loc_key                                                     // Section name.
+                            )
+{
+  if(!has (loc_key))
+  {
+    return 0;
+  }
+
+  return section[loc_key].size ();
+}
+
+void sb::checkpoint::save (
+                           std::string loc_file_name                                                 // File name.
+                          )
+{
+  std::string   temporary = loc_file_name + ".tmp";                                                  // Temporary file name.
+  std::ofstream file (temporary, std::ios::binary | std::ios::trunc);                                // Checkpoint file.
+  char          magic[8]  = {0};                                                                     // Magic string.
+  uint32_t      version   = CHECKPOINT_VERSION;                                                      // Format version.
+  uint32_t      sections  = (uint32_t)section.size ();                                               // Number of sections.
+  uint32_t      key_size;                                                                            // Section name size [bytes].
+  uint64_t      data_size;                                                                           // Section size [bytes].
+
+  if(!file.is_open ())
+  {
+    std::cerr << "Error: cannot open " << temporary << "." << std::endl;                             // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  std::memcpy (magic, CHECKPOINT_MAGIC, std::strlen (CHECKPOINT_MAGIC));                             // Setting magic string...
+  file.write (magic, sizeof (magic));                                                                // Writing magic string...
+  file.write ((const char*)&version, sizeof (version));                                              // Writing format version...
+  file.write ((const char*)&sections, sizeof (sections));                                            // Writing number of sections...
+
+  for(auto& s : section)
+  {
+    key_size  = (uint32_t)s.first.size ();                                                           // Getting section name size...
+    data_size = (uint64_t)s.second.size ();                                                          // Getting section size...
+    file.write ((const char*)&key_size, sizeof (key_size));                                          // Writing section name size...
+    file.write (s.first.data (), key_size);                                                          // Writing section name...
+    file.write ((const char*)&data_size, sizeof (data_size));                                        // Writing section size...
+    file.write (s.second.data (), data_size);                                                        // Writing section data...
+  }
+
+  file.close ();                                                                                     // Closing checkpoint file...
+
+  if(!file)
+  {
+    std::cerr << "Error: cannot write " << temporary << "." << std::endl;                            // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  std::remove (loc_file_name.c_str ());                                                              // Removing previous checkpoint (needed on Windows)...
+
+  if(std::rename (temporary.c_str (), loc_file_name.c_str ()) != 0)
+  {
+    std::cerr << "Error: cannot rename " << temporary << " to " << loc_file_name << "." << std::endl; // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+}
+
+bool sb::checkpoint::load (
+                           std::string loc_file_name                                                 // File name.
+                          )
+{
+  std::ifstream file (loc_file_name, std::ios::binary);                                              // Checkpoint file.
+  char          magic[8];                                                                            // Magic string.
+  uint32_t      version   = 0;                                                                       // Format version.
+  uint32_t      sections  = 0;                                                                       // Number of sections.
+  uint32_t      key_size  = 0;                                                                       // Section name size [bytes].
+  uint64_t      data_size = 0;                                                                       // Section size [bytes].
+  std::string   key;                                                                                 // Section name.
+  uint32_t      i;                                                                                   // Section index.
+
+  if(!file.is_open ())
+  {
+    return false;
+  }
+
+  file.read (magic, sizeof (magic));                                                                 // Reading magic string...
+  file.read ((char*)&version, sizeof (version));                                                     // Reading format version...
+  file.read ((char*)&sections, sizeof (sections));                                                   // Reading number of sections...
+
+  if(!file || (std::strncmp (magic, CHECKPOINT_MAGIC, std::strlen (CHECKPOINT_MAGIC)) != 0) ||
+     (version != CHECKPOINT_VERSION))
+  {
+    std::cerr << "Error: " << loc_file_name << " is not a version " << CHECKPOINT_VERSION
+              << " checkpoint file." << std::endl;                                                   // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  section.clear ();                                                                                  // Resetting sections...
+
+  for(i = 0; i < sections; i++)
+  {
+    file.read ((char*)&key_size, sizeof (key_size));                                                 // Reading section name size...
+    key.resize (key_size);                                                                           // Allocating section name...
+    file.read (&key[0], key_size);                                                                   // Reading section name...
+    file.read ((char*)&data_size, sizeof (data_size));                                               // Reading section size...
+    section[key].resize (data_size);                                                                 // Allocating section...
+    file.read (section[key].data (), data_size);                                                     // Reading section data...
+
+    if(!file)
+    {
+      std::cerr << "Error: " << loc_file_name << " is truncated." << std::endl;                      // Printing message...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+  }
+
+  return true;
+}
+
+void sb::checkpoint::clear ()
+{
+  section.clear ();                                                                                  // Resetting sections...
+}
+
+sb::checkpoint::~checkpoint ()
+{
+  // Doing nothing!
+}
@@ -0,0 +1,83 @@
+/// @file     colouring.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the graph colouring functions.
+
+#include "colouring.hpp"
+
+#include <algorithm>
+
+std::vector<int> sb::colour (
+                             const std::vector<int>& loc_neighbour,                                  // CSR neighbour indices.
+                             const std::vector<int>& loc_offset                                      // CSR neighbour offsets.
+                            )
+{
+  std::vector<int>  colour (loc_offset.size (), -1);                                                 // Node colours.
+  std::vector<bool> used;                                                                            // Colours used by neighbours.
+  size_t            i;                                                                               // Node index.
+  size_t            j;                                                                               // Edge index.
+  size_t            j_min;                                                                           // Edge stride minimum index.
+  int               c;                                                                               // Colour.
+
+  for(i = 0; i < loc_offset.size (); i++)
+  {
+    j_min = (i == 0) ? 0 : loc_offset[i - 1];                                                        // Setting edge stride minimum index...
+    used.assign (loc_offset[i] - j_min + 1, false);                                                  // Resetting used colours...
+
+    for(j = j_min; j < (size_t)loc_offset[i]; j++)
+    {
+      c = colour[loc_neighbour[j]];                                                                  // Getting neighbour colour...
+
+      if((c >= 0) && ((size_t)c < used.size ()))
+      {
+        used[c] = true;                                                                              // Marking neighbour colour...
+      }
+    }
+
+    c = 0;                                                                                           // Finding smallest free colour...
+
+    while(used[c])
+    {
+      c++;
+    }
+
+    colour[i] = c;                                                                                   // Setting node colour...
+  }
+
+  return colour;
+}
+
+size_t sb::colour_classes (
+                           const std::vector<int>& loc_colour,                                       // Node colours.
+                           std::vector<int>&       loc_node,                                         // Nodes sorted by colour.
+                           std::vector<int>&       loc_class_offset                                  // Colour class offsets.
+                          )
+{
+  int    colours = 0;                                                                                // Number of colours.
+  size_t largest = 0;                                                                                // Largest class size.
+  size_t i;                                                                                          // Node index.
+  int    c;                                                                                          // Colour.
+
+  if(!loc_colour.empty ())
+  {
+    colours = *std::max_element (loc_colour.begin (), loc_colour.end ()) + 1;                        // Counting colours...
+  }
+
+  loc_node.clear ();
+  loc_class_offset.clear ();
+
+  for(c = 0; c < colours; c++)
+  {
+    for(i = 0; i < loc_colour.size (); i++)
+    {
+      if(loc_colour[i] == c)
+      {
+        loc_node.push_back ((int)i);                                                                 // Adding node to colour class...
+      }
+    }
+
+    largest = std::max (largest, loc_node.size () - (c == 0 ? 0 : loc_class_offset[c - 1]));         // Updating largest class size...
+    loc_class_offset.push_back ((int)loc_node.size ());                                              // Closing colour class...
+  }
+
+  return largest;
+}
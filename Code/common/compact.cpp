@@ -0,0 +1,57 @@
+/// @file     compact.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the compact storage functions.
+
+#include "compact.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+bool sb::narrow_neighbours (
+                            const std::vector<int>& loc_neighbour,                                   // CSR neighbour indices.
+                            const std::vector<int>& loc_offset,                                      // CSR neighbour offsets.
+                            size_t                  loc_first,                                       // Node of the first CSR row.
+                            size_t                  loc_nodes,                                       // Number of nodes.
+                            std::vector<int>&       loc_packed                                       // Packed neighbour offsets.
+                           )
+{
+  std::vector<int16_t> delta (loc_neighbour.size () + 1, 0);                                         // Neighbour offsets (padded to an even count).
+  int64_t              nodes = (int64_t)loc_nodes;                                                   // Number of nodes.
+  int64_t              d;                                                                            // Neighbour offset.
+  size_t               i;                                                                            // CSR row index.
+  size_t               j;                                                                            // Edge index.
+  size_t               j_min;                                                                        // Row minimum edge index.
+
+  for(i = 0; i < loc_offset.size (); i++)
+  {
+    j_min = (i == 0) ? 0 : loc_offset[i - 1];                                                        // Setting row minimum edge index...
+
+    for(j = j_min; j < (size_t)loc_offset[i]; j++)
+    {
+      d = (int64_t)loc_neighbour[j] - (int64_t)(loc_first + i);                                      // Computing neighbour offset...
+
+      // Taking the shortest way around the node range:
+      if(d > nodes/2)
+      {
+        d -= nodes;                                                                                  // Wrapping neighbour offset...
+      }
+
+      if(d < -nodes/2)
+      {
+        d += nodes;                                                                                  // Wrapping neighbour offset...
+      }
+
+      if((d < INT16_MIN) || (d > INT16_MAX))
+      {
+        return false;
+      }
+
+      delta[j] = (int16_t)d;                                                                         // Setting neighbour offset...
+    }
+  }
+
+  loc_packed.resize ((loc_neighbour.size () + 1)/2);                                                 // Sizing packed offsets...
+  memcpy (loc_packed.data (), delta.data (), loc_packed.size ()*sizeof (int));                       // Packing offsets (two per int, device byte order)...
+
+  return true;
+}
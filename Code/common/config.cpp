@@ -0,0 +1,242 @@
+/// @file     config.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the "config" class.
+
+#include "config.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+
+namespace
+{
+// Trimming white spaces at both ends of a string:
+std::string trim (
+                  std::string loc_text                                                               // Text.
+                 )
+{
+  size_t first = loc_text.find_first_not_of (" \t\r\n");                                             // First non-blank character.
+  size_t last  = loc_text.find_last_not_of (" \t\r\n");                                              // Last non-blank character.
+
+  if(first == std::string::npos)
+  {
+    return "";
+  }
+
+  return loc_text.substr (first, last - first + 1);
+}
+}
+
+sb::config::config ()
+{
+  // Doing nothing!
+}
+
+void sb::config::read (
+                       std::string loc_file_name                                                     // Configuration file name.
+                      )
+{
+  std::ifstream file (loc_file_name);                                                                // Configuration file.
+  std::string   line;                                                                                // Configuration line.
+  size_t        position;                                                                            // Character position.
+
+  if(!file.is_open ())
+  {
+    std::cerr << "Error: unable to open configuration file " << loc_file_name << std::endl;          // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  while(std::getline (file, line))
+  {
+    position = line.find ('#');                                                                      // Finding comment...
+
+    if(position != std::string::npos)
+    {
+      line = line.substr (0, position);                                                              // Removing comment...
+    }
+
+    position = line.find ('=');                                                                      // Finding assignment...
+
+    if(position == std::string::npos)
+    {
+      if(!trim (line).empty ())
+      {
+        std::cerr << "Warning: skipping configuration line \"" << line << "\"" << std::endl;         // Printing message...
+      }
+
+      continue;
+    }
+
+    set (trim (line.substr (0, position)), trim (line.substr (position + 1)));                       // Setting entry...
+  }
+}
+
+void sb::config::parse (
+                        int    loc_argc,                                                             // Number of arguments.
+                        char** loc_argv                                                              // Arguments.
+                       )
+{
+  std::map<std::string, std::string> line_entry;                                                     // Command line entries.
+  std::string                        key;                                                            // Entry key.
+  std::string                        value;                                                          // Entry value.
+  size_t                             position;                                                       // Character position.
+  int                                i;                                                              // Argument index.
+
+  for(i = 1; i < loc_argc; i++)
+  {
+    key = loc_argv[i];                                                                               // Getting argument...
+
+    if(key.compare (0, 2, "--") != 0)
+    {
+      std::cerr << "Error: unexpected argument \"" << key << "\"" << std::endl;                      // Printing message...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    key      = key.substr (2);                                                                       // Removing dashes...
+    position = key.find ('=');                                                                       // Finding assignment...
+
+    if(position != std::string::npos)
+    {
+      value = key.substr (position + 1);                                                             // Getting value ("--key=value")...
+      key   = key.substr (0, position);                                                              // Getting key ("--key=value")...
+    }
+    else if((i + 1) < loc_argc && std::string (loc_argv[i + 1]).compare (0, 2, "--") != 0)
+    {
+      value = loc_argv[++i];                                                                         // Getting value ("--key value")...
+    }
+    else
+    {
+      value = "true";                                                                                // Setting flag ("--key")...
+    }
+
+    line_entry[key] = value;                                                                         // Storing command line entry...
+  }
+
+  if(line_entry.count ("config"))
+  {
+    read (line_entry["config"]);                                                                     // Reading configuration file...
+  }
+
+  for(auto& e : line_entry)
+  {
+    set (e.first, e.second);                                                                         // Overriding file entries...
+  }
+}
+
+void sb::config::set (
+                      std::string loc_key,                                                           // Entry key.
+                      std::string loc_value                                                          // Entry value.
+                     )
+{
+  entry[loc_key] = loc_value;                                                                        // Setting entry...
+}
+
+bool sb::config::has (
+                      std::string loc_key                                                            // Entry key.
+                     )
+{
+  return entry.count (loc_key) > 0;
+}
+
+float sb::config::get (
+                       std::string loc_key,                                                          // Entry key.
+                       float       loc_default                                                       // Default value.
+                      )
+{
+  if(!has (loc_key))
+  {
+    return loc_default;
+  }
+
+  return std::stof (entry[loc_key]);
+}
+
+int sb::config::get (
+                     std::string loc_key,                                                            // Entry key.
+                     int         loc_default                                                         // Default value.
+                    )
+{
+  if(!has (loc_key))
+  {
+    return loc_default;
+  }
+
+  return std::stoi (entry[loc_key]);
+}
+
+bool sb::config::get (
+                      std::string loc_key,                                                           // Entry key.
+                      bool        loc_default                                                        // Default value.
+                     )
+{
+  std::string value;                                                                                 // Entry value.
+
+  if(!has (loc_key))
+  {
+    return loc_default;
+  }
+
+  value = entry[loc_key];                                                                            // Getting value...
+
+  return (value == "true") || (value == "1") || (value == "yes") || (value == "on");
+}
+
+std::string sb::config::get (
+                             std::string loc_key,                                                    // Entry key.
+                             std::string loc_default                                                 // Default value.
+                            )
+{
+  if(!has (loc_key))
+  {
+    return loc_default;
+  }
+
+  return entry[loc_key];
+}
+
+std::string sb::config::get (
+                             std::string loc_key,                                                    // Entry key.
+                             const char* loc_default                                                 // Default value.
+                            )
+{
+  return get (loc_key, std::string (loc_default));
+}
+
+std::vector<std::string> sb::config::list (
+                                          std::string loc_key,                                       // Entry key.
+                                          std::string loc_default                                    // Default value.
+                                         )
+{
+  std::vector<std::string> item;                                                                     // List items.
+  std::string              value = get (loc_key, loc_default);                                       // Entry value.
+  size_t                   first = 0;                                                                // Item first character.
+  size_t                   last;                                                                     // Item separator.
+
+  do
+  {
+    last = value.find (',', first);                                                                  // Finding separator...
+
+    if(!trim (value.substr (first, last - first)).empty ())
+    {
+      item.push_back (trim (value.substr (first, last - first)));                                    // Adding item...
+    }
+
+    first = last + 1;                                                                                // Moving to next item...
+  }
+  while(last != std::string::npos);
+
+  return item;
+}
+
+void sb::config::print ()
+{
+  for(auto& e : entry)
+  {
+    std::cout << e.first << " = " << e.second << std::endl;                                          // Printing message...
+  }
+}
+
+sb::config::~config ()
+{
+  // Doing nothing!
+}
@@ -0,0 +1,86 @@
+/// @file     coupling.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the coupling table functions.
+
+#include "coupling.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+float sb::period (
+                  const std::vector<float>& loc_coordinate,                                          // Node coordinates along the direction.
+                  size_t                    loc_side_nodes                                           // Number of nodes along the direction.
+                 )
+{
+  float extent;                                                                                      // Coordinate extent.
+
+  if(loc_coordinate.empty () || (loc_side_nodes < 2))
+  {
+    return 0.0f;
+  }
+
+  extent = *std::max_element (loc_coordinate.begin (), loc_coordinate.end ()) -
+           *std::min_element (loc_coordinate.begin (), loc_coordinate.end ());                       // Computing coordinate extent...
+
+  return extent*loc_side_nodes/(loc_side_nodes - 1);                                                 // Adding one lattice spacing...
+}
+
+std::vector<float> sb::edge_length (
+                                    const std::vector<float>& loc_x,                                 // Node "x" coordinates.
+                                    const std::vector<float>& loc_y,                                 // Node "y" coordinates.
+                                    const std::vector<int>&   loc_neighbour,                         // CSR neighbour indices.
+                                    const std::vector<int>&   loc_offset,                            // CSR neighbour offsets.
+                                    float                     loc_period_x,                          // Period along "x".
+                                    float                     loc_period_y                           // Period along "y".
+                                   )
+{
+  std::vector<float> length (loc_neighbour.size ());                                                 // Edge lengths.
+  size_t             i;                                                                              // Node index.
+  size_t             j;                                                                              // Edge index.
+  size_t             j_min;                                                                          // Edge stride minimum index.
+  double             link_x;                                                                         // Link "x" component.
+  double             link_y;                                                                         // Link "y" component.
+
+  for(i = 0; i < loc_offset.size (); i++)
+  {
+    j_min = (i == 0) ? 0 : loc_offset[i - 1];                                                        // Setting edge stride minimum index...
+
+    for(j = j_min; j < (size_t)loc_offset[i]; j++)
+    {
+      link_x = (double)loc_x[loc_neighbour[j]] - loc_x[i];                                           // Computing link "x" component...
+      link_y = (double)loc_y[loc_neighbour[j]] - loc_y[i];                                           // Computing link "y" component...
+
+      // Applying minimum image convention:
+      if(loc_period_x > 0.0f)
+      {
+        link_x -= loc_period_x*std::round (link_x/loc_period_x);                                     // Wrapping "x" component...
+      }
+
+      if(loc_period_y > 0.0f)
+      {
+        link_y -= loc_period_y*std::round (link_y/loc_period_y);                                     // Wrapping "y" component...
+      }
+
+      length[j] = (float)std::sqrt (link_x*link_x + link_y*link_y);                                  // Computing link length...
+    }
+  }
+
+  return length;
+}
+
+std::vector<float> sb::coupling (
+                                 const std::vector<float>& loc_length,                               // Edge lengths.
+                                 float                     loc_ds,                                   // Simulation space step.
+                                 float                     loc_alpha                                 // Radial exponent.
+                                )
+{
+  std::vector<float> C (loc_length.size ());                                                         // Coupling table.
+  size_t             j;                                                                              // Edge index.
+
+  for(j = 0; j < loc_length.size (); j++)
+  {
+    C[j] = (float)(0.5/std::pow ((double)loc_length[j]/loc_ds, (double)loc_alpha));                  // Computing radial coupling...
+  }
+
+  return C;
+}
@@ -0,0 +1,385 @@
+/// @file     halo.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the "halo" class.
+
+#include "halo.hpp"
+
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <atomic>
+#include <new>
+#include <thread>
+#include <chrono>
+
+#ifdef __linux__
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+#define HALO_HEADER 128                                                                              // Halo file header size [bytes].
+
+namespace
+{
+// Halo file header (followed by the double buffered global values and reduction slots):
+struct halo_header
+{
+  char                  magic[8];                                                                    // Magic string.
+  uint64_t              key;                                                                         // Run key.
+  uint64_t              parts;                                                                       // Number of partitions.
+  uint64_t              values;                                                                      // Global values.
+  uint64_t              reduction;                                                                   // Reduction values per partition.
+  std::atomic<uint32_t> arrived;                                                                     // Barrier arrivals.
+  std::atomic<uint32_t> sense;                                                                       // Barrier sense.
+  std::atomic<uint32_t> closed;                                                                      // Partitions done.
+  std::atomic<uint32_t> aborted;                                                                     // Poison flag (a partition stopped with an error).
+};
+
+static_assert (sizeof (halo_header) <= HALO_HEADER, "halo header too large");
+}
+
+sb::halo::halo ()
+{
+  base             = nullptr;                                                                        // Resetting mapped file...
+  size             = 0;                                                                              // Resetting mapped file size...
+  parts            = 1;                                                                              // Resetting number of partitions...
+  part             = 0;                                                                              // Resetting partition index...
+  values           = 0;                                                                              // Resetting global values...
+  reduction        = 0;                                                                              // Resetting reduction values...
+  sense            = 0;                                                                              // Resetting barrier sense...
+  value_parity     = 0;                                                                              // Resetting global values buffer...
+  reduction_parity = 0;                                                                              // Resetting reduction buffer...
+}
+
+float* sb::halo::value_buffer (
+                               size_t loc_parity                                                     // Buffer parity.
+                              )
+{
+  return (float*)(base + HALO_HEADER) + loc_parity*values;
+}
+
+float* sb::halo::reduction_buffer (
+                                   size_t loc_parity,                                                // Buffer parity.
+                                   size_t loc_part                                                   // Partition index.
+                                  )
+{
+  return (float*)(base + HALO_HEADER) + 2*values + (loc_parity*parts + loc_part)*reduction;
+}
+
+void sb::halo::barrier ()
+{
+  halo_header*                          header = (halo_header*)base;                                 // Halo file header.
+  std::chrono::steady_clock::time_point start  = std::chrono::steady_clock::now ();                  // Barrier arrival time.
+
+  sense ^= 1;                                                                                        // Flipping barrier sense...
+
+  if(header->arrived.fetch_add (1) == parts - 1)
+  {
+    header->arrived.store (0);                                                                       // Resetting barrier arrivals...
+    header->sense.store (sense);                                                                     // Releasing all partitions...
+  }
+  else
+  {
+    while(header->sense.load () != sense)
+    {
+      if(header->aborted.load () != 0)
+      {
+        std::cerr << "Error: partition " << part << ": another partition stopped the halo exchange."
+                  << std::endl;                                                                      // Printing message...
+        exit (EXIT_FAILURE);                                                                         // Exiting...
+      }
+
+      if(std::chrono::steady_clock::now () - start > std::chrono::seconds (HALO_TIMEOUT))
+      {
+        header->aborted.store (1);                                                                   // Poisoning halo file (stopping all partitions)...
+        std::cerr << "Error: partition " << part << ": no answer from the other partitions in "
+                  << HALO_TIMEOUT << " s." << std::endl;                                             // Printing message...
+        exit (EXIT_FAILURE);                                                                         // Exiting...
+      }
+
+      std::this_thread::yield ();                                                                    // Waiting for all partitions...
+    }
+  }
+}
+
+bool sb::halo::open (
+                     std::string loc_file_name,                                                      // Halo file name.
+                     uint64_t    loc_key,                                                            // Run key.
+                     size_t      loc_parts,                                                          // Number of partitions.
+                     size_t      loc_part,                                                           // Partition index.
+                     size_t      loc_values,                                                         // Global values (nodes x replicas).
+                     size_t      loc_reduction                                                       // Reduction values per partition.
+                    )
+{
+  close ();                                                                                          // Closing previous file...
+
+  file      = loc_file_name;                                                                         // Setting halo file name...
+  parts     = loc_parts;                                                                             // Setting number of partitions...
+  part      = loc_part;                                                                              // Setting partition index...
+  values    = loc_values;                                                                            // Setting global values...
+  reduction = loc_reduction;                                                                         // Setting reduction values...
+  size      = HALO_HEADER + 2*(values + parts*reduction)*sizeof (float);                             // Computing mapped file size...
+
+#ifdef __linux__
+  halo_header* header;                                                                               // Halo file header.
+  std::string  temporary = file + ".tmp";                                                            // Temporary file name.
+  struct stat  status;                                                                               // File status.
+  void*        map;                                                                                  // Mapped file.
+  int          descriptor;                                                                           // File descriptor.
+  int          waited;                                                                               // Waiting time [s].
+
+  if(part == 0)
+  {
+    // CREATING HALO FILE (temporary file renamed when ready):
+    ::unlink (file.c_str ());                                                                        // Removing stale file...
+    descriptor = ::open (temporary.c_str (), O_RDWR | O_CREAT | O_TRUNC, 0600);                      // Creating file...
+
+    if((descriptor < 0) || (ftruncate (descriptor, size) != 0))
+    {
+      if(descriptor >= 0)
+      {
+        ::close (descriptor);                                                                        // Closing file...
+      }
+
+      return false;
+    }
+
+    map = mmap (nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);                   // Mapping file...
+    ::close (descriptor);                                                                            // Closing file (the mapping stays valid)...
+
+    if(map == MAP_FAILED)
+    {
+      return false;
+    }
+
+    base   = (char*)map;                                                                             // Setting mapped file...
+    header = new (base) halo_header;                                                                 // Constructing header...
+    std::memcpy (header->magic, HALO_MAGIC, sizeof (HALO_MAGIC));                                    // Setting magic string...
+    header->key       = loc_key;                                                                     // Setting run key...
+    header->parts     = parts;                                                                       // Setting number of partitions...
+    header->values    = values;                                                                      // Setting global values...
+    header->reduction = reduction;                                                                   // Setting reduction values...
+    header->arrived.store (0);                                                                       // Resetting barrier arrivals...
+    header->sense.store (0);                                                                         // Resetting barrier sense...
+    header->closed.store (0);                                                                        // Resetting partitions done...
+    header->aborted.store (0);                                                                       // Resetting poison flag...
+    std::rename (temporary.c_str (), file.c_str ());                                                 // Publishing file...
+  }
+  else
+  {
+    // WAITING FOR THE HALO FILE OF THIS RUN:
+    for(waited = 0; base == nullptr; waited++)
+    {
+      if(waited > HALO_TIMEOUT)
+      {
+        return false;
+      }
+
+      descriptor = ::open (file.c_str (), O_RDWR);                                                   // Opening file...
+
+      if(descriptor >= 0)
+      {
+        if((fstat (descriptor, &status) == 0) && ((size_t)status.st_size == size))
+        {
+          map = mmap (nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);             // Mapping file...
+
+          if(map != MAP_FAILED)
+          {
+            header = (halo_header*)map;                                                              // Getting header...
+
+            if((std::memcmp (header->magic, HALO_MAGIC, sizeof (HALO_MAGIC)) == 0) &&
+               (header->key == loc_key) && (header->parts == parts) && (header->values == values) &&
+               (header->reduction == reduction))
+            {
+              base = (char*)map;                                                                     // Setting mapped file...
+            }
+            else
+            {
+              munmap (map, size);                                                                    // Unmapping stale file...
+            }
+          }
+        }
+
+        ::close (descriptor);                                                                        // Closing file (the mapping stays valid)...
+      }
+
+      if(base == nullptr)
+      {
+        std::this_thread::sleep_for (std::chrono::seconds (1));                                      // Waiting for partition 0...
+      }
+    }
+  }
+
+  barrier ();                                                                                        // Waiting for all partitions...
+
+  return true;
+#else
+  std::cerr << "Error: multi-device runs need POSIX shared memory (Linux)." << std::endl;            // Printing message...
+
+  return false;
+#endif
+}
+
+void sb::halo::exchange (
+                         float*                  loc_packed,                                         // Packed halo values.
+                         size_t                  loc_nodes,                                          // Number of nodes (all partitions).
+                         const std::vector<int>& loc_boundary,                                       // Boundary nodes.
+                         const std::vector<int>& loc_ghost                                           // Ghost nodes.
+                        )
+{
+  float* shared;                                                                                     // Global values buffer.
+  float* ghost_packed;                                                                               // Packed ghost values.
+  size_t replicas = values/loc_nodes;                                                                // Number of replica slices.
+  size_t q;                                                                                          // Replica slice index.
+  size_t b;                                                                                          // Boundary index.
+  size_t g;                                                                                          // Ghost index.
+
+  value_parity ^= 1;                                                                                 // Switching global values buffer...
+  shared        = value_buffer (value_parity);                                                       // Getting global values buffer...
+  ghost_packed  = loc_packed + replicas*loc_boundary.size ();                                        // Getting packed ghost values...
+
+  for(q = 0; q < replicas; q++)
+  {
+    for(b = 0; b < loc_boundary.size (); b++)
+    {
+      shared[q*loc_nodes + loc_boundary[b]] = loc_packed[q*loc_boundary.size () + b];                // Publishing boundary node...
+    }
+  }
+
+  barrier ();                                                                                        // Waiting for all partitions...
+
+  for(q = 0; q < replicas; q++)
+  {
+    for(g = 0; g < loc_ghost.size (); g++)
+    {
+      ghost_packed[q*loc_ghost.size () + g] = shared[q*loc_nodes + loc_ghost[g]];                    // Gathering ghost node...
+    }
+  }
+}
+
+void sb::halo::publish (
+                        const float*            loc_data,                                            // Theta (all replica slices).
+                        size_t                  loc_slice,                                           // Slice size.
+                        size_t                  loc_nodes,                                           // Number of nodes (all partitions).
+                        size_t                  loc_begin,                                           // First owned node.
+                        size_t                  loc_end                                              // Last owned node + 1.
+                       )
+{
+  float* shared;                                                                                     // Global values buffer.
+  size_t q;                                                                                          // Replica slice index.
+
+  value_parity ^= 1;                                                                                 // Switching global values buffer...
+  shared        = value_buffer (value_parity);                                                       // Getting global values buffer...
+
+  for(q = 0; q < values/loc_nodes; q++)
+  {
+    std::memcpy (
+                 shared + q*loc_nodes + loc_begin,
+                 loc_data + q*loc_slice,
+                 (loc_end - loc_begin)*sizeof (float)
+                );                                                                                   // Publishing owned nodes...
+  }
+
+  barrier ();                                                                                        // Waiting for all partitions...
+}
+
+const float* sb::halo::global ()
+{
+  return value_buffer (value_parity);
+}
+
+void sb::halo::reduce (
+                       float* loc_data                                                               // Partition values.
+                      )
+{
+  size_t p;                                                                                          // Partition index.
+  size_t k;                                                                                          // Value index.
+  float* slot;                                                                                       // Reduction slot.
+
+  reduction_parity ^= 1;                                                                             // Switching reduction buffer...
+  std::memcpy (reduction_buffer (reduction_parity, part), loc_data, reduction*sizeof (float));       // Publishing partition values...
+  barrier ();                                                                                        // Waiting for all partitions...
+
+  for(k = 0; k < reduction; k++)
+  {
+    loc_data[k] = 0.0f;                                                                              // Resetting sum...
+  }
+
+  for(p = 0; p < parts; p++)
+  {
+    slot = reduction_buffer (reduction_parity, p);                                                   // Getting partition slot...
+
+    for(k = 0; k < reduction; k++)
+    {
+      loc_data[k] += slot[k];                                                                        // Summing partition values (same order everywhere)...
+    }
+  }
+}
+
+void sb::halo::abort ()
+{
+  if(base != nullptr)
+  {
+    ((halo_header*)base)->aborted.store (1);                                                         // Poisoning halo file...
+  }
+}
+
+void sb::halo::close ()
+{
+#ifdef __linux__
+  halo_header* header = (halo_header*)base;                                                          // Halo file header.
+
+  if(base == nullptr)
+  {
+    return;
+  }
+
+  if(header->closed.fetch_add (1) == parts - 1)
+  {
+    ::unlink (file.c_str ());                                                                        // Removing halo file (last partition)...
+  }
+
+  munmap (base, size);                                                                               // Unmapping file...
+#endif
+
+  base = nullptr;                                                                                    // Resetting mapped file...
+}
+
+sb::halo::~halo ()
+{
+  close ();                                                                                          // Closing file...
+}
+
+bool sb::bind_device (
+                      const std::vector<std::string>& loc_device,                                    // Device indices (one per partition).
+                      size_t                          loc_part                                       // Partition index.
+                     )
+{
+  // Visible-devices variables of the vendor runtimes (NVIDIA, AMD ROCm, AMD APP, Intel Level Zero):
+  const char* variable[] = {"CUDA_VISIBLE_DEVICES", "ROCR_VISIBLE_DEVICES", "GPU_DEVICE_ORDINAL",
+                            "ZE_AFFINITY_MASK"};
+  size_t      i;                                                                                     // Variable index.
+
+  if(loc_device.empty ())
+  {
+    return true;
+  }
+
+  if((loc_part >= loc_device.size ()) ||
+     (loc_device[loc_part].find_first_not_of ("0123456789") != std::string::npos))
+  {
+    return false;
+  }
+
+#ifdef __linux__
+  for(i = 0; i < sizeof (variable)/sizeof (variable[0]); i++)
+  {
+    setenv (variable[i], loc_device[loc_part].c_str (), 0);                                          // Setting variable (unless already set)...
+  }
+#endif
+
+  return true;
+}
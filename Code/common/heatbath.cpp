@@ -0,0 +1,22 @@
+/// @file     heatbath.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the heat-bath (von Mises) draw.
+/// @details  Compiles the kernel source (Code/kernel/heatbath.cl) as C++, with the float overloads
+/// of the OpenCL C math functions it calls.
+
+#include "heatbath.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+namespace sb
+{
+using std::sqrt;
+using std::cos;
+using std::sin;
+using std::log;
+using std::asin;
+using std::min;
+
+#include "../kernel/heatbath.cl"
+}
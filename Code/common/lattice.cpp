@@ -0,0 +1,93 @@
+/// @file     lattice.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the "lattice" class.
+
+#include "lattice.hpp"
+
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+
+sb::lattice::lattice ()
+{
+  side_x_nodes = 0;                                                                                  // Resetting number of nodes along "x"...
+  side_y_nodes = 0;                                                                                  // Resetting number of nodes along "y"...
+  ds           = 0.0f;                                                                               // Resetting lattice spacing...
+}
+
+void sb::lattice::generate (
+                            size_t loc_side_x_nodes,                                                 // Number of nodes along "x".
+                            size_t loc_side_y_nodes,                                                 // Number of nodes along "y".
+                            size_t loc_stencil                                                       // Neighbours per node (4 or 8).
+                           )
+{
+  size_t    i;                                                                                       // Column index.
+  size_t    j;                                                                                       // Row index.
+  size_t    k;                                                                                       // Stencil index.
+  size_t    n;                                                                                       // Node index.
+  size_t    e;                                                                                       // Edge index.
+  size_t    nodes_total;                                                                             // Number of nodes.
+  const int di[8] = {+1, -1, 0, 0, +1, -1, -1, +1};                                                  // Stencil "x" steps.
+  const int dj[8] = {0, 0, +1, -1, +1, +1, -1, -1};                                                  // Stencil "y" steps.
+
+  if((loc_stencil != 4) && (loc_stencil != 8))
+  {
+    std::cerr << "Error: lattice stencil must be 4 or 8." << std::endl;                              // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  if((loc_side_x_nodes < 3) || (loc_side_y_nodes < 3))
+  {
+    std::cerr << "Error: lattice sides must have at least 3 nodes." << std::endl;                    // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  side_x_nodes = loc_side_x_nodes;                                                                   // Setting number of nodes along "x"...
+  side_y_nodes = loc_side_y_nodes;                                                                   // Setting number of nodes along "y"...
+  ds           = 2.0f/(side_x_nodes - 1);                                                            // Setting lattice spacing...
+  nodes_total  = side_x_nodes*side_y_nodes;                                                          // Computing number of nodes...
+
+  // SIZING ARRAYS (no reallocation while generating):
+  node.resize (nodes_total);                                                                         // Sizing node indices...
+  x.resize (nodes_total);                                                                            // Sizing node "x" coordinates...
+  y.resize (nodes_total);                                                                            // Sizing node "y" coordinates...
+  offset.resize (nodes_total);                                                                       // Sizing CSR neighbour offsets...
+  neighbour.resize (nodes_total*loc_stencil);                                                        // Sizing CSR neighbour indices...
+  length.resize (nodes_total*loc_stencil);                                                           // Sizing edge lengths...
+
+  // GENERATING NODES AND LINKS (row by row):
+  e = 0;                                                                                             // Resetting edge index...
+
+  for(j = 0; j < side_y_nodes; j++)
+  {
+    for(i = 0; i < side_x_nodes; i++)
+    {
+      n         = j*side_x_nodes + i;                                                                // Computing node index...
+      node[n]   = (int)n;                                                                            // Setting node index...
+      x[n]      = -1.0f + i*ds;                                                                      // Setting node "x" coordinate...
+      y[n]      = (j - 0.5f*(side_y_nodes - 1))*ds;                                                  // Setting node "y" coordinate (centred)...
+
+      for(k = 0; k < loc_stencil; k++)
+      {
+        neighbour[e] = (int)(
+                             ((j + side_y_nodes + dj[k])%side_y_nodes)*side_x_nodes +
+                             (i + side_x_nodes + di[k])%side_x_nodes
+                            );                                                                       // Setting neighbour index (periodic)...
+        length[e]    = (k < 4) ? ds : (float)sqrt (2.0)*ds;                                          // Setting edge length...
+        e++;                                                                                         // Updating edge index...
+      }
+
+      offset[n] = (int)e;                                                                            // Setting CSR neighbour offset...
+    }
+  }
+}
+
+size_t sb::lattice::nodes ()
+{
+  return node.size ();
+}
+
+sb::lattice::~lattice ()
+{
+  // Doing nothing!
+}
@@ -0,0 +1,119 @@
+/// @file     long_range.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the long-range coupling functions.
+
+#include "long_range.hpp"
+
+#include <cmath>
+#include <complex>
+#include <algorithm>
+
+namespace
+{
+// In-place radix-2 forward FFT of "n" values at "first", "first + stride", ... (n power of two):
+void fft (
+          std::vector<std::complex<double> >& loc_data,                                              // Data.
+          size_t                              loc_first,                                             // First value index.
+          size_t                              loc_n,                                                 // Number of values.
+          size_t                              loc_stride                                             // Value stride.
+         )
+{
+  size_t               i;                                                                            // Value index.
+  size_t               j = 0;                                                                        // Bit-reversed value index.
+  size_t               k;                                                                            // Butterfly index.
+  size_t               bit;                                                                          // Bit-reversal bit.
+  size_t               length;                                                                       // Butterfly span.
+  std::complex<double> a;                                                                            // Butterfly upper value.
+  std::complex<double> b;                                                                            // Butterfly lower value.
+
+  // Reordering values (bit reversal):
+  for(i = 1; i < loc_n; i++)
+  {
+    for(bit = loc_n >> 1; j & bit; bit >>= 1)
+    {
+      j ^= bit;                                                                                      // Clearing bit...
+    }
+
+    j ^= bit;                                                                                        // Setting bit...
+
+    if(i < j)
+    {
+      std::swap (loc_data[loc_first + i*loc_stride], loc_data[loc_first + j*loc_stride]);            // Swapping values...
+    }
+  }
+
+  // Combining butterflies of increasing span:
+  for(length = 2; length <= loc_n; length <<= 1)
+  {
+    for(i = 0; i < loc_n; i += length)
+    {
+      for(k = 0; k < length/2; k++)
+      {
+        a = loc_data[loc_first + (i + k)*loc_stride];                                                // Getting upper value...
+        b = loc_data[loc_first + (i + k + length/2)*loc_stride]*
+            std::polar (1.0, -2.0*M_PI*k/length);                                                    // Getting twiddled lower value...
+        loc_data[loc_first + (i + k)*loc_stride]              = a + b;                               // Setting upper value...
+        loc_data[loc_first + (i + k + length/2)*loc_stride]   = a - b;                               // Setting lower value...
+      }
+    }
+  }
+}
+}
+
+bool sb::power_of_two (
+                       size_t loc_n                                                                  // Number.
+                      )
+{
+  return (loc_n > 0) && ((loc_n & (loc_n - 1)) == 0);
+}
+
+std::vector<float> sb::long_range_spectrum (
+                                            size_t loc_columns,                                      // Number of grid columns.
+                                            size_t loc_rows,                                         // Number of grid rows.
+                                            float  loc_spacing,                                      // Grid spacing (in units of ds).
+                                            float  loc_alpha                                         // Radial exponent.
+                                           )
+{
+  std::vector<std::complex<double> > J (loc_columns*loc_rows);                                       // Coupling (then its transform).
+  std::vector<float>                 spectrum (loc_columns*loc_rows);                                // Coupling spectrum.
+  size_t                             x;                                                              // Column index.
+  size_t                             y;                                                              // Row index.
+  double                             dx;                                                             // Minimum image column distance.
+  double                             dy;                                                             // Minimum image row distance.
+  double                             r;                                                              // Distance (in units of ds).
+
+  // Setting coupling at minimum image distance (no self-coupling):
+  for(y = 0; y < loc_rows; y++)
+  {
+    for(x = 0; x < loc_columns; x++)
+    {
+      dx = (double)std::min (x, loc_columns - x);                                                    // Computing column distance...
+      dy = (double)std::min (y, loc_rows - y);                                                       // Computing row distance...
+      r  = loc_spacing*sqrt (dx*dx + dy*dy);                                                         // Computing distance...
+
+      if(r > 0.0)
+      {
+        J[y*loc_columns + x] = 0.5/pow (r, (double)loc_alpha);                                       // Setting coupling...
+      }
+    }
+  }
+
+  // Transforming rows, then columns:
+  for(y = 0; y < loc_rows; y++)
+  {
+    fft (J, y*loc_columns, loc_columns, 1);                                                          // Transforming row...
+  }
+
+  for(x = 0; x < loc_columns; x++)
+  {
+    fft (J, x, loc_rows, loc_columns);                                                               // Transforming column...
+  }
+
+  // Keeping the real part (J even), scaled for the inverse transform:
+  for(x = 0; x < J.size (); x++)
+  {
+    spectrum[x] = (float)(J[x].real ()/(loc_columns*loc_rows));                                      // Setting spectrum...
+  }
+
+  return spectrum;
+}
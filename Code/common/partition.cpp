@@ -0,0 +1,137 @@
+/// @file     partition.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the "partition" class.
+
+#include "partition.hpp"
+
+#include <algorithm>
+
+sb::partition::partition ()
+{
+  begin = 0;                                                                                         // Resetting first owned node...
+  end   = 0;                                                                                         // Resetting last owned node...
+}
+
+void sb::partition::split (
+                           const std::vector<int>& loc_neighbour,                                    // CSR neighbour indices.
+                           const std::vector<int>& loc_offset,                                       // CSR neighbour offsets.
+                           size_t                  loc_parts,                                        // Number of partitions.
+                           size_t                  loc_part                                          // Partition index.
+                          )
+{
+  size_t edges = loc_neighbour.size ();                                                              // Number of edges.
+  size_t edge_begin;                                                                                 // First owned edge target.
+  size_t edge_end;                                                                                   // Last owned edge target.
+  size_t j_begin;                                                                                    // First owned edge.
+  size_t j_end;                                                                                      // Last owned edge + 1.
+  size_t j;                                                                                          // Edge index.
+  size_t n;                                                                                          // Node index.
+
+  // SETTING OWNED RANGE (first rows whose offset reaches the edge targets):
+  edge_begin = edges*loc_part/loc_parts;                                                             // Computing first owned edge target...
+  edge_end   = edges*(loc_part + 1)/loc_parts;                                                       // Computing last owned edge target...
+  begin      = std::upper_bound (loc_offset.begin (), loc_offset.end (), (int)edge_begin) -
+               loc_offset.begin ();                                                                  // Finding first owned node...
+  end        = std::upper_bound (loc_offset.begin (), loc_offset.end (), (int)edge_end) -
+               loc_offset.begin ();                                                                  // Finding last owned node...
+
+  if(loc_part == 0)
+  {
+    begin = 0;                                                                                       // Starting from the first node...
+  }
+
+  if(loc_part == loc_parts - 1)
+  {
+    end = loc_offset.size ();                                                                        // Ending at the last node...
+  }
+
+  // COLLECTING GHOST NODES:
+  j_begin = (begin == 0) ? 0 : loc_offset[begin - 1];                                                // Setting first owned edge...
+  j_end   = (end == 0) ? 0 : loc_offset[end - 1];                                                    // Setting last owned edge...
+  ghost.clear ();
+
+  for(j = j_begin; j < j_end; j++)
+  {
+    if(((size_t)loc_neighbour[j] < begin) || ((size_t)loc_neighbour[j] >= end))
+    {
+      ghost.push_back (loc_neighbour[j]);                                                            // Collecting ghost node...
+    }
+  }
+
+  // COLLECTING BOUNDARY NODES (owned nodes with a neighbour outside the range):
+  boundary.clear ();
+
+  for(n = begin; n < end; n++)
+  {
+    for(j = (n == 0) ? 0 : loc_offset[n - 1]; j < (size_t)loc_offset[n]; j++)
+    {
+      if(((size_t)loc_neighbour[j] < begin) || ((size_t)loc_neighbour[j] >= end))
+      {
+        boundary.push_back ((int)n);                                                                 // Collecting boundary node...
+        break;
+      }
+    }
+  }
+
+  std::sort (ghost.begin (), ghost.end ());                                                          // Sorting ghost nodes...
+  ghost.erase (std::unique (ghost.begin (), ghost.end ()), ghost.end ());                            // Removing duplicates...
+}
+
+void sb::partition::slice (
+                           std::vector<int>&   loc_neighbour,                                        // CSR neighbour indices.
+                           std::vector<int>&   loc_offset,                                           // CSR neighbour offsets.
+                           std::vector<float>& loc_coupling                                          // Per-edge float array.
+                          )
+{
+  size_t j_begin = (begin == 0) ? 0 : loc_offset[begin - 1];                                         // First owned edge.
+  size_t j_end   = (end == 0) ? 0 : loc_offset[end - 1];                                             // Last owned edge + 1.
+  size_t i;                                                                                          // Row index.
+  size_t j;                                                                                          // Edge index.
+  size_t k;                                                                                          // Neighbour node.
+
+  std::vector<int> (loc_neighbour.begin () + j_begin, loc_neighbour.begin () + j_end).swap (loc_neighbour); // Slicing neighbour indices...
+  std::vector<float> (loc_coupling.begin () + j_begin, loc_coupling.begin () + j_end).swap (loc_coupling); // Slicing per-edge float array...
+  std::vector<int> (loc_offset.begin () + begin, loc_offset.begin () + end).swap (loc_offset);       // Slicing neighbour offsets...
+
+  for(i = 0; i < loc_offset.size (); i++)
+  {
+    loc_offset[i] -= (int)j_begin;                                                                   // Rebasing neighbour offset...
+  }
+
+  for(j = 0; j < loc_neighbour.size (); j++)
+  {
+    k = loc_neighbour[j];                                                                            // Getting neighbour node...
+
+    if((k >= begin) && (k < end))
+    {
+      loc_neighbour[j] = (int)(k - begin);                                                           // Mapping owned node to its slice index...
+    }
+    else
+    {
+      loc_neighbour[j] = (int)(nodes () + (std::lower_bound (ghost.begin (), ghost.end (), (int)k) -
+                                           ghost.begin ()));                                         // Mapping ghost node to its slice index...
+    }
+  }
+}
+
+size_t sb::partition::nodes ()
+{
+  return end - begin;
+}
+
+size_t sb::partition::size ()
+{
+  return nodes () + ghost.size ();
+}
+
+size_t sb::partition::node (
+                            size_t loc_index                                                         // Slice index.
+                           )
+{
+  return (loc_index < nodes ()) ? begin + loc_index : ghost[loc_index - nodes ()];
+}
+
+sb::partition::~partition ()
+{
+  // Doing nothing!
+}
@@ -0,0 +1,218 @@
+/// @file     profiler.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the "profiler" class.
+
+#include "profiler.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+sb::profiler::profiler ()
+{
+  origin  = std::chrono::steady_clock::now ();                                                       // Getting creation time...
+  enabled = false;                                                                                   // Resetting profiling flag...
+}
+
+size_t sb::profiler::channel (
+                              std::string loc_name                                                   // Channel name.
+                             )
+{
+  std::map<std::string, size_t>::iterator entry = index.find (loc_name);                             // Channel entry.
+
+  if(entry != index.end ())
+  {
+    return entry->second;
+  }
+
+  // ADDING NEW CHANNEL:
+  index[loc_name] = name.size ();                                                                    // Setting channel index...
+  name.push_back (loc_name);                                                                         // Setting channel name...
+  sample.push_back (std::vector<double> ());                                                         // Adding channel samples...
+  sample.back ().reserve (PROFILE_WINDOW);                                                           // Reserving rolling window...
+  count.push_back (0);                                                                               // Resetting channel samples...
+  start.push_back (std::chrono::steady_clock::now ());                                               // Resetting channel timer...
+
+  return name.size () - 1;
+}
+
+bool sb::profiler::open (
+                         std::string loc_file_name                                                   // Timing log file name.
+                        )
+{
+  file.open (loc_file_name);                                                                         // Creating timing log...
+
+  if(!file.is_open ())
+  {
+    return false;
+  }
+
+  file << "#step\t#channel\t#samples\t#mean\t#p50\t#p99" << std::endl;                               // Writing header...
+  enabled = true;                                                                                    // Enabling profiler...
+
+  return true;
+}
+
+bool sb::profiler::is_enabled ()
+{
+  return enabled;
+}
+
+void sb::profiler::begin (
+                          std::string loc_name                                                       // Channel name.
+                         )
+{
+  if(!enabled)
+  {
+    return;
+  }
+
+  start[channel (loc_name)] = std::chrono::steady_clock::now ();                                     // Starting timer...
+}
+
+void sb::profiler::end (
+                        std::string loc_name                                                         // Channel name.
+                       )
+{
+  std::chrono::steady_clock::time_point stop;                                                        // Timer stop.
+  size_t                                c;                                                           // Channel index.
+
+  if(!enabled)
+  {
+    return;
+  }
+
+  stop = std::chrono::steady_clock::now ();                                                          // Stopping timer...
+  c    = channel (loc_name);                                                                         // Getting channel...
+  add (loc_name, std::chrono::duration<double, std::micro> (stop - start[c]).count ());              // Adding elapsed time [us]...
+}
+
+void sb::profiler::add (
+                        std::string loc_name,                                                        // Channel name.
+                        double      loc_value                                                        // Sample.
+                       )
+{
+  size_t c;                                                                                          // Channel index.
+
+  if(!enabled)
+  {
+    return;
+  }
+
+  c = channel (loc_name);                                                                            // Getting channel...
+
+  if(sample[c].size () < PROFILE_WINDOW)
+  {
+    sample[c].push_back (loc_value);                                                                 // Filling rolling window...
+  }
+  else
+  {
+    sample[c][count[c] % PROFILE_WINDOW] = loc_value;                                                // Replacing oldest sample...
+  }
+
+  count[c]++;                                                                                        // Updating channel samples...
+}
+
+double sb::profiler::last (
+                           std::string loc_name                                                      // Channel name.
+                          )
+{
+  std::map<std::string, size_t>::iterator entry = index.find (loc_name);                             // Channel entry.
+  size_t                                   c;                                                        // Channel index.
+
+  if((entry == index.end ()) || sample[entry->second].empty ())
+  {
+    return 0.0;
+  }
+
+  c = entry->second;                                                                                 // Getting channel index...
+
+  return sample[c][(count[c] - 1) % PROFILE_WINDOW];
+}
+
+double sb::profiler::mean (
+                           std::string loc_name                                                      // Channel name.
+                          )
+{
+  std::map<std::string, size_t>::iterator entry = index.find (loc_name);                             // Channel entry.
+  double                                   sum   = 0.0;                                              // Sample summation.
+  size_t                                   k;                                                        // Sample index.
+
+  if((entry == index.end ()) || sample[entry->second].empty ())
+  {
+    return 0.0;
+  }
+
+  for(k = 0; k < sample[entry->second].size (); k++)
+  {
+    sum += sample[entry->second][k];                                                                 // Summing samples...
+  }
+
+  return sum/sample[entry->second].size ();
+}
+
+double sb::profiler::percentile (
+                                 std::string loc_name,                                               // Channel name.
+                                 double      loc_p                                                   // Percentile [%].
+                                )
+{
+  std::map<std::string, size_t>::iterator entry = index.find (loc_name);                             // Channel entry.
+  std::vector<double>                      window;                                                   // Sorted window.
+  size_t                                   k;                                                        // Percentile index.
+
+  if((entry == index.end ()) || sample[entry->second].empty ())
+  {
+    return 0.0;
+  }
+
+  window = sample[entry->second];                                                                    // Copying window...
+  k      = (size_t)(loc_p/100.0*(window.size () - 1) + 0.5);                                         // Computing percentile index (nearest rank)...
+  std::nth_element (window.begin (), window.begin () + k, window.end ());                            // Selecting percentile...
+
+  return window[k];
+}
+
+double sb::profiler::uptime ()
+{
+  return std::chrono::duration<double, std::micro> (std::chrono::steady_clock::now () - origin).count ();
+}
+
+void sb::profiler::write (
+                          size_t loc_step                                                            // Step index.
+                         )
+{
+  size_t c;                                                                                          // Channel index.
+
+  if(!enabled)
+  {
+    return;
+  }
+
+  for(c = 0; c < name.size (); c++)
+  {
+    file << loc_step << "\t" << name[c] << "\t" << count[c] << "\t" << mean (name[c]) << "\t"
+         << percentile (name[c], 50.0) << "\t" << percentile (name[c], 99.0) << "\n";                // Writing channel statistics...
+  }
+
+  file.flush ();                                                                                     // Flushing timing log...
+}
+
+void sb::profiler::print ()
+{
+  size_t c;                                                                                          // Channel index.
+
+  if(!enabled)
+  {
+    return;
+  }
+
+  for(c = 0; c < name.size (); c++)
+  {
+    std::cout << name[c] << ": mean = " << mean (name[c]) << ", p50 = " << percentile (name[c], 50.0)
+              << ", p99 = " << percentile (name[c], 99.0) << std::endl;                              // Printing channel statistics...
+  }
+}
+
+sb::profiler::~profiler ()
+{
+  // Doing nothing!
+}
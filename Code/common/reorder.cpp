@@ -0,0 +1,200 @@
+/// @file     reorder.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the node reordering functions.
+
+#include "reorder.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+// Spreading the 16 low bits of a word over its even bits:
+uint32_t spread_bits (
+                      uint32_t loc_word                                                              // Word.
+                     )
+{
+  loc_word &= 0x0000FFFF;
+  loc_word  = (loc_word | (loc_word << 8)) & 0x00FF00FF;
+  loc_word  = (loc_word | (loc_word << 4)) & 0x0F0F0F0F;
+  loc_word  = (loc_word | (loc_word << 2)) & 0x33333333;
+  loc_word  = (loc_word | (loc_word << 1)) & 0x55555555;
+
+  return loc_word;
+}
+}
+
+std::vector<int> sb::rcm_order (
+                                const std::vector<int>& loc_neighbour,                               // CSR neighbour indices.
+                                const std::vector<int>& loc_offset                                   // CSR neighbour offsets.
+                               )
+{
+  size_t            nodes = loc_offset.size ();                                                      // Number of nodes.
+  std::vector<int>  order;                                                                           // Order.
+  std::vector<int>  degree (nodes);                                                                  // Node degrees.
+  std::vector<int>  seed (nodes);                                                                    // Nodes by increasing degree.
+  std::vector<bool> visited (nodes, false);                                                          // Visited nodes.
+  std::vector<int>  next;                                                                            // Unvisited neighbours of the current node.
+  size_t            head;                                                                            // Queue head.
+  size_t            i;                                                                               // Node index.
+  size_t            j;                                                                               // Edge index.
+  size_t            j_min;                                                                           // Node stride minimum index.
+  int               n;                                                                               // Current node.
+
+  order.reserve (nodes);                                                                             // Reserving order...
+
+  for(i = 0; i < nodes; i++)
+  {
+    degree[i] = loc_offset[i] - ((i == 0) ? 0 : loc_offset[i - 1]);                                  // Computing node degree...
+    seed[i]   = (int)i;                                                                              // Setting seed candidate...
+  }
+
+  std::stable_sort (
+                    seed.begin (),
+                    seed.end (),
+                    [&degree](int a, int b) {return degree[a] < degree[b];}
+                   );                                                                                // Sorting seeds by degree...
+
+  // VISITING ALL CONNECTED COMPONENTS (breadth-first, from a minimum degree node):
+  for(i = 0; i < nodes; i++)
+  {
+    if(visited[seed[i]])
+    {
+      continue;
+    }
+
+    visited[seed[i]] = true;                                                                         // Visiting seed...
+    head             = order.size ();                                                                // Setting queue head...
+    order.push_back (seed[i]);                                                                       // Queueing seed...
+
+    while(head < order.size ())
+    {
+      n     = order[head++];                                                                         // Dequeueing node...
+      j_min = (n == 0) ? 0 : loc_offset[n - 1];                                                      // Setting stride minimum...
+      next.clear ();
+
+      for(j = j_min; j < (size_t)loc_offset[n]; j++)
+      {
+        if(!visited[loc_neighbour[j]])
+        {
+          visited[loc_neighbour[j]] = true;                                                          // Visiting neighbour...
+          next.push_back (loc_neighbour[j]);                                                         // Collecting neighbour...
+        }
+      }
+
+      std::stable_sort (
+                        next.begin (),
+                        next.end (),
+                        [&degree](int a, int b) {return degree[a] < degree[b];}
+                       );                                                                            // Sorting neighbours by degree...
+      order.insert (order.end (), next.begin (), next.end ());                                       // Queueing neighbours...
+    }
+  }
+
+  std::reverse (order.begin (), order.end ());                                                       // Reversing (Cuthill-McKee -> RCM)...
+
+  return order;
+}
+
+std::vector<int> sb::morton_order (
+                                   const std::vector<float>& loc_x,                                  // Node "x" coordinates.
+                                   const std::vector<float>& loc_y                                   // Node "y" coordinates.
+                                  )
+{
+  size_t                nodes = loc_x.size ();                                                       // Number of nodes.
+  std::vector<int>      order (nodes);                                                               // Order.
+  std::vector<uint32_t> key (nodes);                                                                 // Morton keys.
+  float                 x_min;                                                                       // Bounding box "x" minimum.
+  float                 x_max;                                                                       // Bounding box "x" maximum.
+  float                 y_min;                                                                       // Bounding box "y" minimum.
+  float                 y_max;                                                                       // Bounding box "y" maximum.
+  float                 sx;                                                                          // "x" quantization scale.
+  float                 sy;                                                                          // "y" quantization scale.
+  size_t                i;                                                                           // Node index.
+
+  if(nodes == 0)
+  {
+    return order;
+  }
+
+  x_min = *std::min_element (loc_x.begin (), loc_x.end ());                                          // Getting "x" minimum...
+  x_max = *std::max_element (loc_x.begin (), loc_x.end ());                                          // Getting "x" maximum...
+  y_min = *std::min_element (loc_y.begin (), loc_y.end ());                                          // Getting "y" minimum...
+  y_max = *std::max_element (loc_y.begin (), loc_y.end ());                                          // Getting "y" maximum...
+  sx    = (x_max > x_min) ? 65535.0f/(x_max - x_min) : 0.0f;                                         // Setting "x" quantization scale...
+  sy    = (y_max > y_min) ? 65535.0f/(y_max - y_min) : 0.0f;                                         // Setting "y" quantization scale...
+
+  for(i = 0; i < nodes; i++)
+  {
+    key[i]   = spread_bits ((uint32_t)((loc_x[i] - x_min)*sx)) |
+               (spread_bits ((uint32_t)((loc_y[i] - y_min)*sy)) << 1);                               // Computing Morton key...
+    order[i] = (int)i;                                                                               // Setting order...
+  }
+
+  std::stable_sort (
+                    order.begin (),
+                    order.end (),
+                    [&key](int a, int b) {return key[a] < key[b];}
+                   );                                                                                // Sorting nodes by Morton key...
+
+  return order;
+}
+
+void sb::permute_csr (
+                      const std::vector<int>& loc_order,                                             // Order (order[new] = old).
+                      std::vector<int>&       loc_neighbour,                                         // CSR neighbour indices.
+                      std::vector<int>&       loc_offset,                                            // CSR neighbour offsets.
+                      std::vector<float>*     loc_edge                                               // Per-edge array (optional, nullptr = none).
+                     )
+{
+  size_t             nodes = loc_order.size ();                                                      // Number of nodes.
+  std::vector<int>   inverse (nodes);                                                                // Inverse order (inverse[old] = new).
+  std::vector<int>   neighbour (loc_neighbour.size ());                                              // Permuted neighbour indices.
+  std::vector<int>   offset (nodes);                                                                 // Permuted neighbour offsets.
+  std::vector<float> edge;                                                                           // Permuted per-edge array.
+  size_t             i;                                                                              // New node index.
+  size_t             j;                                                                              // Old edge index.
+  size_t             j_min;                                                                          // Old node stride minimum index.
+  size_t             e;                                                                              // New edge index.
+  int                o;                                                                              // Old node index.
+
+  if(loc_edge != nullptr)
+  {
+    edge.resize (loc_edge->size ());                                                                 // Sizing permuted per-edge array...
+  }
+
+  for(i = 0; i < nodes; i++)
+  {
+    inverse[loc_order[i]] = (int)i;                                                                  // Inverting order...
+  }
+
+  e = 0;                                                                                             // Resetting new edge index...
+
+  for(i = 0; i < nodes; i++)
+  {
+    o     = loc_order[i];                                                                            // Getting old node index...
+    j_min = (o == 0) ? 0 : loc_offset[o - 1];                                                        // Setting old stride minimum...
+
+    for(j = j_min; j < (size_t)loc_offset[o]; j++)
+    {
+      neighbour[e] = inverse[loc_neighbour[j]];                                                      // Renumbering neighbour...
+
+      if(loc_edge != nullptr)
+      {
+        edge[e] = (*loc_edge)[j];                                                                    // Moving edge data...
+      }
+
+      e++;                                                                                           // Updating new edge index...
+    }
+
+    offset[i] = (int)e;                                                                              // Setting new offset...
+  }
+
+  loc_neighbour.swap (neighbour);                                                                    // Setting permuted neighbour indices...
+  loc_offset.swap (offset);                                                                          // Setting permuted neighbour offsets...
+
+  if(loc_edge != nullptr)
+  {
+    loc_edge->swap (edge);                                                                           // Setting permuted per-edge array...
+  }
+}
@@ -0,0 +1,361 @@
+/// @file     snapshot.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the binary snapshot classes.
+
+#include "snapshot.hpp"
+
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+
+#ifdef __linux__
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+namespace
+{
+// Accumulating bytes into a 64-bit FNV-1a hash:
+void fnv1a (
+            uint64_t&   loc_hash,                                                                    // Hash.
+            const void* loc_data,                                                                    // Data.
+            size_t      loc_size                                                                     // Data size [bytes].
+           )
+{
+  const unsigned char* byte = (const unsigned char*)loc_data;                                        // Data bytes.
+  size_t               i;                                                                            // Byte index.
+
+  for(i = 0; i < loc_size; i++)
+  {
+    loc_hash ^= byte[i];                                                                             // Mixing byte...
+    loc_hash *= 1099511628211ULL;                                                                    // Multiplying by FNV prime...
+  }
+}
+}
+
+uint64_t sb::mesh_hash (
+                        const std::vector<float>& loc_x,                                             // Node "x" coordinates.
+                        const std::vector<float>& loc_y,                                             // Node "y" coordinates.
+                        const std::vector<int>&   loc_neighbour,                                     // CSR neighbour indices.
+                        const std::vector<int>&   loc_offset                                         // CSR neighbour offsets.
+                       )
+{
+  uint64_t hash = 14695981039346656037ULL;                                                           // FNV offset basis.
+
+  fnv1a (hash, loc_x.data (), loc_x.size ()*sizeof (float));                                         // Hashing "x" coordinates...
+  fnv1a (hash, loc_y.data (), loc_y.size ()*sizeof (float));                                         // Hashing "y" coordinates...
+  fnv1a (hash, loc_neighbour.data (), loc_neighbour.size ()*sizeof (int));                           // Hashing neighbour indices...
+  fnv1a (hash, loc_offset.data (), loc_offset.size ()*sizeof (int));                                 // Hashing neighbour offsets...
+
+  return hash;
+}
+
+uint64_t sb::file_hash (
+                       std::string loc_file_name                                                     // File name.
+                      )
+{
+  uint64_t          hash = 14695981039346656037ULL;                                                  // FNV offset basis.
+  std::ifstream     file (loc_file_name, std::ios::binary);                                          // File.
+  std::vector<char> block (1 << 20);                                                                 // Read block.
+
+  if(!file.is_open ())
+  {
+    return 0;
+  }
+
+  while(file)
+  {
+    file.read (block.data (), block.size ());                                                        // Reading block...
+    fnv1a (hash, block.data (), (size_t)file.gcount ());                                             // Hashing block...
+  }
+
+  return hash;
+}
+
+bool sb::is_snapshot (
+                      std::string loc_file_name                                                      // File name.
+                     )
+{
+  std::string ext = std::string (".") + SNAPSHOT_EXT;                                                // Snapshot extension.
+
+  return (loc_file_name.size () > ext.size ()) &&
+         (loc_file_name.compare (loc_file_name.size () - ext.size (), ext.size (), ext) == 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// SNAPSHOT WRITER ////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+sb::snapshot_writer::snapshot_writer ()
+{
+  nodes     = 0;                                                                                     // Resetting number of nodes...
+  rng_words = 0;                                                                                     // Resetting random generator state words...
+}
+
+void sb::snapshot_writer::open (
+                                std::string               loc_file_name,                             // File name (with extension).
+                                uint64_t                  loc_mesh_hash,                             // Mesh hash.
+                                const std::vector<int>&   loc_index,                                 // Node indices.
+                                const std::vector<float>& loc_x,                                     // Node "x" coordinates.
+                                const std::vector<float>& loc_y,                                     // Node "y" coordinates.
+                                bool                      loc_rng                                    // "true" = store random generator state.
+                               )
+{
+  snapshot_file_header header;                                                                       // File header.
+
+  nodes     = (uint32_t)loc_x.size ();                                                               // Setting number of nodes...
+  rng_words = loc_rng ? SNAPSHOT_RNG : 0;                                                            // Setting random generator state words...
+
+  std::memset (&header, 0, sizeof (header));                                                         // Resetting header...
+  std::memcpy (header.magic, SNAPSHOT_MAGIC, std::strlen (SNAPSHOT_MAGIC));                          // Setting magic string...
+  header.version   = SNAPSHOT_VERSION;                                                               // Setting format version...
+  header.nodes     = nodes;                                                                          // Setting number of nodes...
+  header.mesh_hash = loc_mesh_hash;                                                                  // Setting mesh hash...
+  header.rng_words = rng_words;                                                                      // Setting random generator state words...
+
+  file.open (loc_file_name, std::ios::binary | std::ios::trunc);                                     // Opening snapshot file...
+
+  if(!file.is_open ())
+  {
+    std::cerr << "Error: cannot open " << loc_file_name << "." << std::endl;                         // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  file.write ((const char*)&header, sizeof (header));                                                // Writing file header...
+  file.write ((const char*)loc_index.data (), nodes*sizeof (int));                                   // Writing node indices...
+  file.write ((const char*)loc_x.data (), nodes*sizeof (float));                                     // Writing node "x" coordinates...
+  file.write ((const char*)loc_y.data (), nodes*sizeof (float));                                     // Writing node "y" coordinates...
+  file.flush ();                                                                                     // Flushing file...
+}
+
+bool sb::snapshot_writer::is_open ()
+{
+  return file.is_open ();
+}
+
+void sb::snapshot_writer::write (
+                                 uint64_t                  loc_step,                                 // Step.
+                                 uint32_t                  loc_trial,                                // Trial index.
+                                 uint32_t                  loc_replica,                              // Replica index.
+                                 const std::vector<float>& loc_parameter,                            // Parameters.
+                                 const float*              loc_theta,                                // Theta.
+                                 const int*                loc_rng_theta,                            // Random generator state (theta).
+                                 const int*                loc_rng_threshold                         // Random generator state (threshold).
+                                )
+{
+  snapshot_record_header record;                                                                     // Record header.
+  size_t                 i;                                                                          // Parameter index.
+
+  std::memset (&record, 0, sizeof (record));                                                         // Resetting record header...
+  record.step    = loc_step;                                                                         // Setting step...
+  record.trial   = loc_trial;                                                                        // Setting trial index...
+  record.replica = loc_replica;                                                                      // Setting replica index...
+
+  for(i = 0; (i < loc_parameter.size ()) && (i < SNAPSHOT_PARAMETERS); i++)
+  {
+    record.parameter[i] = loc_parameter[i];                                                          // Setting parameter...
+  }
+
+  file.write ((const char*)&record, sizeof (record));                                                // Writing record header...
+  file.write ((const char*)loc_theta, nodes*sizeof (float));                                         // Writing theta...
+
+  if(rng_words > 0)
+  {
+    file.write ((const char*)loc_rng_theta, (size_t)nodes*(rng_words/2)*sizeof (int));               // Writing random generator state (theta)...
+    file.write ((const char*)loc_rng_threshold, (size_t)nodes*(rng_words/2)*sizeof (int));           // Writing random generator state (threshold)...
+  }
+
+  file.flush ();                                                                                     // Flushing file (readable while running)...
+}
+
+void sb::snapshot_writer::close ()
+{
+  if(file.is_open ())
+  {
+    file.close ();                                                                                   // Closing snapshot file...
+  }
+}
+
+sb::snapshot_writer::~snapshot_writer ()
+{
+  close ();                                                                                          // Closing snapshot file...
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// SNAPSHOT READER ////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+sb::snapshot_reader::snapshot_reader ()
+{
+  base        = nullptr;                                                                             // Resetting mapped file...
+  size        = 0;                                                                                   // Resetting file size...
+  data_offset = 0;                                                                                   // Resetting first record offset...
+  record_size = 0;                                                                                   // Resetting record size...
+  std::memset (&header, 0, sizeof (header));                                                         // Resetting header...
+}
+
+bool sb::snapshot_reader::open (
+                                std::string loc_file_name                                            // File name (with extension).
+                               )
+{
+  close ();                                                                                          // Closing previous file...
+
+#ifdef __linux__
+  int         descriptor;                                                                            // File descriptor.
+  struct stat status;                                                                                // File status.
+  void*       map;                                                                                   // Mapped file.
+
+  descriptor = ::open (loc_file_name.c_str (), O_RDONLY);                                            // Opening file...
+
+  if(descriptor < 0)
+  {
+    return false;
+  }
+
+  if((fstat (descriptor, &status) != 0) || (status.st_size == 0))
+  {
+    ::close (descriptor);                                                                            // Closing file...
+    return false;
+  }
+
+  size = (size_t)status.st_size;                                                                     // Getting file size...
+  map  = mmap (nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);                                 // Mapping file...
+  ::close (descriptor);                                                                              // Closing file (the mapping stays valid)...
+
+  if(map == MAP_FAILED)
+  {
+    size = 0;                                                                                        // Resetting file size...
+    return false;
+  }
+
+  base = (const char*)map;                                                                           // Setting mapped file...
+#else
+  std::ifstream file (loc_file_name, std::ios::binary | std::ios::ate);                              // Snapshot file.
+
+  if(!file.is_open ())
+  {
+    return false;
+  }
+
+  size = (size_t)file.tellg ();                                                                      // Getting file size...
+  buffer.resize (size);                                                                              // Allocating file buffer...
+  file.seekg (0);                                                                                    // Rewinding file...
+  file.read (buffer.data (), size);                                                                  // Reading file...
+  base = buffer.data ();                                                                             // Setting file buffer...
+#endif
+
+  if(size < sizeof (header))
+  {
+    std::cerr << "Error: " << loc_file_name << " is not a snapshot file." << std::endl;              // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  std::memcpy (&header, base, sizeof (header));                                                      // Getting file header...
+
+  if((std::strncmp (header.magic, SNAPSHOT_MAGIC, std::strlen (SNAPSHOT_MAGIC)) != 0) ||
+     (header.version != SNAPSHOT_VERSION))
+  {
+    std::cerr << "Error: " << loc_file_name << " is not a version " << SNAPSHOT_VERSION
+              << " snapshot file." << std::endl;                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  data_offset = sizeof (header) + (size_t)header.nodes*(sizeof (int) + 2*sizeof (float));            // Computing first record offset...
+  record_size = sizeof (snapshot_record_header) + (size_t)header.nodes*sizeof (float) +
+                (size_t)header.nodes*header.rng_words*sizeof (int);                                  // Computing record size...
+
+  if(size < data_offset)
+  {
+    std::cerr << "Error: " << loc_file_name << " is truncated." << std::endl;                        // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  return true;
+}
+
+size_t sb::snapshot_reader::nodes ()
+{
+  return header.nodes;
+}
+
+uint64_t sb::snapshot_reader::mesh_hash ()
+{
+  return header.mesh_hash;
+}
+
+bool sb::snapshot_reader::has_rng ()
+{
+  return header.rng_words > 0;
+}
+
+size_t sb::snapshot_reader::records ()
+{
+  if(base == nullptr)
+  {
+    return 0;
+  }
+
+  return (size - data_offset)/record_size;                                                           // Complete records only...
+}
+
+const int* sb::snapshot_reader::index ()
+{
+  return (const int*)(base + sizeof (header));
+}
+
+const float* sb::snapshot_reader::x ()
+{
+  return (const float*)(base + sizeof (header) + header.nodes*sizeof (int));
+}
+
+const float* sb::snapshot_reader::y ()
+{
+  return (const float*)(base + sizeof (header) + header.nodes*(sizeof (int) + sizeof (float)));
+}
+
+const sb::snapshot_record_header* sb::snapshot_reader::record (
+                                                               size_t loc_record                     // Record index.
+                                                              )
+{
+  return (const snapshot_record_header*)(base + data_offset + loc_record*record_size);
+}
+
+const float* sb::snapshot_reader::theta (
+                                         size_t loc_record                                           // Record index.
+                                        )
+{
+  return (const float*)(base + data_offset + loc_record*record_size + sizeof (snapshot_record_header));
+}
+
+const int* sb::snapshot_reader::rng (
+                                     size_t loc_record                                               // Record index.
+                                    )
+{
+  if(header.rng_words == 0)
+  {
+    return nullptr;
+  }
+
+  return (const int*)(base + data_offset + loc_record*record_size + sizeof (snapshot_record_header) +
+                      header.nodes*sizeof (float));
+}
+
+void sb::snapshot_reader::close ()
+{
+#ifdef __linux__
+  if(base != nullptr)
+  {
+    munmap ((void*)base, size);                                                                      // Unmapping file...
+  }
+#else
+  buffer.clear ();                                                                                   // Releasing file buffer...
+#endif
+
+  base = nullptr;                                                                                    // Resetting mapped file...
+  size = 0;                                                                                          // Resetting file size...
+}
+
+sb::snapshot_reader::~snapshot_reader ()
+{
+  close ();                                                                                          // Unmapping file...
+}
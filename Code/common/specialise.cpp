@@ -0,0 +1,43 @@
+/// @file     specialise.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the kernel specialisation function.
+
+#include "specialise.hpp"
+
+#include <cstddef>
+
+namespace
+{
+// Run constants of the parameter array (macro name and index, must match utilities.cl):
+const char*  constant_name[]  = {"SB_M_MAX", "SB_NODES", "SB_DEPTH", "SB_GROUPS", "SB_REPLICAS",
+                                 "SB_RNG", "SB_COLUMNS", "SB_GRID_ROWS", "SB_STENCIL", "SB_SAMPLER",
+                                 "SB_ROWS", "SB_LONG_RANGE", "SB_FIRST", "SB_COMPACT", "SB_BOUNDARY",
+                                 "SB_ENERGY"};
+const size_t constant_index[] = {4, 5, 9, 10, 11, 13, 16, 17, 18, 19, 20, 23, 24, 25, 26, 27};
+}
+
+std::string sb::kernel_options (
+                                const std::vector<float>&       loc_parameter,                       // Parameter array.
+                                const std::map<size_t, size_t>& loc_exact,                           // Exact run constants (by parameter index).
+                                const std::set<size_t>&         loc_runtime                          // Runtime parameters (by parameter index).
+                               )
+{
+  std::string options;                                                                               // Build options.
+  size_t      value;                                                                                 // Constant value.
+  size_t      i;                                                                                     // Constant index.
+
+  for(i = 0; i < sizeof (constant_index)/sizeof (constant_index[0]); i++)
+  {
+    if(loc_runtime.count (constant_index[i]))
+    {
+      continue;                                                                                      // Leaving runtime parameter to the array...
+    }
+
+    value    = loc_exact.count (constant_index[i]) ? loc_exact.at (constant_index[i]) :
+               (size_t)loc_parameter[constant_index[i]];                                             // Getting constant value...
+    options += options.empty () ? "" : " ";                                                          // Separating options...
+    options += std::string ("-D ") + constant_name[i] + "=" + std::to_string (value) + "u";          // Adding option...
+  }
+
+  return options;
+}
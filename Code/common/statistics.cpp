@@ -0,0 +1,197 @@
+/// @file     statistics.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the "statistics" class.
+
+#include "statistics.hpp"
+
+#include <cmath>
+
+sb::statistics::statistics ()
+{
+  clear ();                                                                                          // Resetting accumulators...
+}
+
+double sb::statistics::variance (
+                                 size_t loc_level                                                    // Blocking level.
+                                )
+{
+  double mean_level;                                                                                 // Level mean.
+
+  if(blocks[loc_level] < 2.0)
+  {
+    return 0.0;
+  }
+
+  mean_level = sum[loc_level]/blocks[loc_level];                                                     // Computing level mean...
+
+  return fmax (sum2[loc_level]/blocks[loc_level] - mean_level*mean_level, 0.0);
+}
+
+double sb::statistics::level_error (
+                                    size_t loc_level                                                 // Blocking level.
+                                   )
+{
+  if(blocks[loc_level] < 2.0)
+  {
+    return 0.0;
+  }
+
+  return sqrt (variance (loc_level)/(blocks[loc_level] - 1.0));
+}
+
+size_t sb::statistics::plateau_level ()
+{
+  size_t l;                                                                                          // Blocking level.
+  double naive = naive_error ();                                                                     // Naive standard error.
+  double ratio;                                                                                      // Level to naive variance ratio (2*tau_l).
+
+  if(naive == 0.0)
+  {
+    return (blocks[0] >= 2.0) ? 0 : STAT_LEVELS;
+  }
+
+  for(l = 0; (l < STAT_LEVELS) && (blocks[l] >= STAT_MIN_BLOCKS); l++)
+  {
+    ratio = pow (level_error (l)/naive, 2);                                                          // Computing variance ratio...
+
+    // TESTING OPTIMAL BLOCK LENGTH (B^3 > 2*n*(2*tau_l)^2, B = 2^l):
+    if(pow (2.0, 3.0*l) > 2.0*blocks[0]*ratio*ratio)
+    {
+      return l;
+    }
+  }
+
+  return STAT_LEVELS;
+}
+
+void sb::statistics::add (
+                          double loc_sample                                                          // Sample.
+                         )
+{
+  size_t l;                                                                                          // Blocking level.
+  double block = loc_sample;                                                                         // Block value.
+
+  for(l = 0; l < STAT_LEVELS; l++)
+  {
+    sum[l]  += block;                                                                                // Accumulating block...
+    sum2[l] += block*block;                                                                          // Accumulating block square...
+    blocks[l]++;                                                                                     // Updating number of blocks...
+
+    if(waiting[l] == 0.0)
+    {
+      pending[l] = block;                                                                            // Keeping block for its pair...
+      waiting[l] = 1.0;                                                                              // Setting pending flag...
+      break;
+    }
+
+    block      = 0.5*(pending[l] + block);                                                           // Averaging block pair (next level block)...
+    waiting[l] = 0.0;                                                                                // Resetting pending flag...
+  }
+}
+
+void sb::statistics::clear ()
+{
+  sum.assign (STAT_LEVELS, 0.0);                                                                     // Resetting block summation...
+  sum2.assign (STAT_LEVELS, 0.0);                                                                    // Resetting block square summation...
+  blocks.assign (STAT_LEVELS, 0.0);                                                                  // Resetting number of blocks...
+  pending.assign (STAT_LEVELS, 0.0);                                                                 // Resetting pending blocks...
+  waiting.assign (STAT_LEVELS, 0.0);                                                                 // Resetting pending flags...
+}
+
+double sb::statistics::samples ()
+{
+  return blocks[0];
+}
+
+double sb::statistics::mean ()
+{
+  if(blocks[0] == 0.0)
+  {
+    return 0.0;
+  }
+
+  return sum[0]/blocks[0];
+}
+
+double sb::statistics::naive_error ()
+{
+  return level_error (0);
+}
+
+double sb::statistics::error ()
+{
+  size_t l;                                                                                          // Blocking level.
+  size_t level = plateau_level ();                                                                   // Plateau level.
+  double error_max = naive_error ();                                                                 // Largest level error.
+
+  if(level < STAT_LEVELS)
+  {
+    return level_error (level);
+  }
+
+  for(l = 1; (l < STAT_LEVELS) && (blocks[l] >= STAT_MIN_BLOCKS); l++)
+  {
+    error_max = fmax (error_max, level_error (l));                                                   // Updating largest level error (lower bound)...
+  }
+
+  return error_max;
+}
+
+bool sb::statistics::plateau ()
+{
+  return plateau_level () < STAT_LEVELS;
+}
+
+double sb::statistics::tau ()
+{
+  double naive = naive_error ();                                                                     // Naive standard error.
+
+  if(naive == 0.0)
+  {
+    return 0.5;
+  }
+
+  return 0.5*pow (error ()/naive, 2);
+}
+
+double sb::statistics::effective_samples ()
+{
+  return blocks[0]/(2.0*tau ());
+}
+
+bool sb::statistics::converged (
+                                double loc_target                                                    // Target standard error.
+                               )
+{
+  return (blocks[0] >= 2.0*STAT_MIN_BLOCKS) && plateau () &&
+         (effective_samples () >= STAT_MIN_BLOCKS) && (error () <= loc_target);
+}
+
+std::vector<double> sb::statistics::state ()
+{
+  std::vector<double> accumulator;                                                                   // Accumulator state.
+
+  accumulator.insert (accumulator.end (), sum.begin (), sum.end ());                                 // Adding block summation...
+  accumulator.insert (accumulator.end (), sum2.begin (), sum2.end ());                               // Adding block square summation...
+  accumulator.insert (accumulator.end (), blocks.begin (), blocks.end ());                           // Adding number of blocks...
+  accumulator.insert (accumulator.end (), pending.begin (), pending.end ());                         // Adding pending blocks...
+  accumulator.insert (accumulator.end (), waiting.begin (), waiting.end ());                         // Adding pending flags...
+
+  return accumulator;
+}
+
+void sb::statistics::restore (
+                              const std::vector<double>& loc_state                                   // Accumulator state.
+                             )
+{
+  sum.assign (loc_state.begin (), loc_state.begin () + STAT_LEVELS);                                 // Restoring block summation...
+  sum2.assign (loc_state.begin () + STAT_LEVELS, loc_state.begin () + 2*STAT_LEVELS);                // Restoring block square summation...
+  blocks.assign (loc_state.begin () + 2*STAT_LEVELS, loc_state.begin () + 3*STAT_LEVELS);            // Restoring number of blocks...
+  pending.assign (loc_state.begin () + 3*STAT_LEVELS, loc_state.begin () + 4*STAT_LEVELS);           // Restoring pending blocks...
+  waiting.assign (loc_state.begin () + 4*STAT_LEVELS, loc_state.begin () + 5*STAT_LEVELS);           // Restoring pending flags...
+}
+
+sb::statistics::~statistics ()
+{
+  // Doing nothing!
+}
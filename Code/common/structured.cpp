@@ -0,0 +1,187 @@
+/// @file     structured.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the structured grid detection function.
+
+#include "structured.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// Clustering sorted coordinates into distinct grid lines (coordinates closer than "loc_tolerance" merge):
+std::vector<float> grid_lines (
+                               std::vector<float> loc_coordinate,                                    // Node coordinates.
+                               float              loc_tolerance                                      // Tolerance.
+                              )
+{
+  std::vector<float> line;                                                                           // Grid lines.
+  size_t             i;                                                                              // Node index.
+
+  std::sort (loc_coordinate.begin (), loc_coordinate.end ());                                        // Sorting coordinates...
+
+  for(i = 0; i < loc_coordinate.size (); i++)
+  {
+    if(line.empty () || ((loc_coordinate[i] - line.back ()) > loc_tolerance))
+    {
+      line.push_back (loc_coordinate[i]);                                                            // Adding grid line...
+    }
+  }
+
+  return line;
+}
+
+// Finding the grid line of a coordinate:
+size_t grid_line (
+                  const std::vector<float>& loc_line,                                                // Grid lines.
+                  float                     loc_coordinate,                                          // Node coordinate.
+                  float                     loc_tolerance                                            // Tolerance.
+                 )
+{
+  return std::lower_bound (loc_line.begin (), loc_line.end (), loc_coordinate - loc_tolerance) -
+         loc_line.begin ();
+}
+}
+
+bool sb::structured_grid (
+                          const std::vector<float>& loc_x,                                           // Node "x" coordinates.
+                          const std::vector<float>& loc_y,                                           // Node "y" coordinates.
+                          const std::vector<int>&   loc_neighbour,                                   // CSR neighbour indices.
+                          const std::vector<int>&   loc_offset,                                      // CSR neighbour offsets.
+                          const std::vector<float>& loc_length,                                      // Edge lengths.
+                          float                     loc_ds,                                          // Grid spacing (tolerance scale).
+                          std::vector<int>&         loc_grid,                                        // Node of each grid cell.
+                          size_t&                   loc_columns,                                     // Number of grid columns.
+                          size_t&                   loc_rows,                                        // Number of grid rows.
+                          size_t&                   loc_stencil                                      // Neighbours per node (4 or 8).
+                         )
+{
+  size_t              nodes     = loc_x.size ();                                                     // Number of nodes.
+  float               tolerance = 1.0E-3f*loc_ds;                                                    // Coordinate and length tolerance.
+  std::vector<float>  column_line;                                                                   // Grid column lines.
+  std::vector<float>  row_line;                                                                      // Grid row lines.
+  std::vector<size_t> column;                                                                        // Node grid column.
+  std::vector<size_t> row;                                                                           // Node grid row.
+  size_t              i;                                                                             // Node index.
+  size_t              j;                                                                             // Edge index.
+  size_t              j_min;                                                                         // Node stride minimum index.
+  size_t              k;                                                                             // Neighbour index.
+  size_t              dx;                                                                            // Neighbour column step (periodic).
+  size_t              dy;                                                                            // Neighbour row step (periodic).
+  int                 sx;                                                                            // Neighbour column step (-1, 0, +1).
+  int                 sy;                                                                            // Neighbour row step (-1, 0, +1).
+  unsigned int        mask;                                                                          // Stencil directions found.
+  unsigned int        bit;                                                                           // Stencil direction.
+  float               L;                                                                             // Expected edge length.
+  float               L_axial;                                                                       // Axial edge length.
+  size_t              j_axial;                                                                       // Axial reference edge index.
+  size_t              j_diagonal;                                                                    // Diagonal reference edge index.
+
+  if((nodes == 0) || (loc_offset.size () != nodes))
+  {
+    return false;
+  }
+
+  // CHECKING UNIFORM STENCIL:
+  loc_stencil = loc_offset[0];                                                                       // Getting node 0 degree...
+
+  if((loc_stencil != 4) && (loc_stencil != 8))
+  {
+    return false;
+  }
+
+  for(i = 1; i < nodes; i++)
+  {
+    if((size_t)(loc_offset[i] - loc_offset[i - 1]) != loc_stencil)
+    {
+      return false;
+    }
+  }
+
+  // FINDING GRID LINES:
+  column_line = grid_lines (loc_x, tolerance);                                                       // Finding grid columns...
+  row_line    = grid_lines (loc_y, tolerance);                                                       // Finding grid rows...
+  loc_columns = column_line.size ();                                                                 // Getting number of columns...
+  loc_rows    = row_line.size ();                                                                    // Getting number of rows...
+
+  if((loc_columns < 3) || (loc_rows < 3) || ((loc_columns*loc_rows) != nodes))
+  {
+    return false;
+  }
+
+  // FILLING GRID CELLS (one node per cell):
+  loc_grid.assign (nodes, -1);                                                                       // Resetting grid cells...
+  column.resize (nodes);                                                                             // Sizing node grid columns...
+  row.resize (nodes);                                                                                // Sizing node grid rows...
+
+  for(i = 0; i < nodes; i++)
+  {
+    column[i] = grid_line (column_line, loc_x[i], tolerance);                                        // Getting node grid column...
+    row[i]    = grid_line (row_line, loc_y[i], tolerance);                                           // Getting node grid row...
+
+    if(loc_grid[row[i]*loc_columns + column[i]] != -1)
+    {
+      return false;
+    }
+
+    loc_grid[row[i]*loc_columns + column[i]] = (int)i;                                               // Setting grid cell node...
+  }
+
+  // SETTING REFERENCE EDGES (first node):
+  j_axial    = 0;                                                                                    // Resetting axial reference edge...
+  j_diagonal = 0;                                                                                    // Resetting diagonal reference edge...
+  L_axial    = 0.0f;                                                                                 // Resetting axial edge length...
+
+  for(j = 0; j < (size_t)loc_offset[0]; j++)
+  {
+    k = loc_neighbour[j];                                                                            // Getting neighbour...
+
+    if((column[k] != column[0]) && (row[k] != row[0]))
+    {
+      j_diagonal = j;                                                                                // Setting diagonal reference edge...
+    }
+    else
+    {
+      j_axial = j;                                                                                   // Setting axial reference edge...
+      L_axial = loc_length[j];                                                                       // Setting axial edge length...
+    }
+  }
+
+  // CHECKING IMPLICIT STENCIL (all directions exactly once, with the expected lengths):
+
+  for(i = 0; i < nodes; i++)
+  {
+    j_min = (i == 0) ? 0 : loc_offset[i - 1];                                                        // Setting stride minimum...
+    mask  = 0;                                                                                       // Resetting stencil directions...
+
+    for(j = j_min; j < (size_t)loc_offset[i]; j++)
+    {
+      k  = loc_neighbour[j];                                                                         // Getting neighbour...
+      dx = (column[k] + loc_columns - column[i])%loc_columns;                                        // Computing column step (periodic)...
+      dy = (row[k] + loc_rows - row[i])%loc_rows;                                                    // Computing row step (periodic)...
+      sx = (dx == 0) ? 0 : ((dx == 1) ? +1 : ((dx == (loc_columns - 1)) ? -1 : 2));                  // Mapping column step...
+      sy = (dy == 0) ? 0 : ((dy == 1) ? +1 : ((dy == (loc_rows - 1)) ? -1 : 2));                     // Mapping row step...
+
+      if((sx == 2) || (sy == 2) || ((sx == 0) && (sy == 0)) || ((loc_stencil == 4) && (sx != 0) && (sy != 0)))
+      {
+        return false;
+      }
+
+      bit = 1u << ((sy + 1)*3 + (sx + 1));                                                           // Setting stencil direction...
+
+      L   = ((sx != 0) && (sy != 0)) ? (float)std::sqrt (2.0)*L_axial : L_axial;                     // Setting expected edge length...
+
+      if((mask & bit) || (std::fabs (loc_length[j] - L) > tolerance))
+      {
+        return false;
+      }
+
+      mask |= bit;                                                                                   // Adding stencil direction...
+    }
+  }
+
+  loc_grid.push_back ((int)j_axial);                                                                 // Appending axial reference edge...
+  loc_grid.push_back ((int)((loc_stencil == 8) ? j_diagonal : j_axial));                             // Appending diagonal reference edge...
+
+  return true;
+}
@@ -0,0 +1,276 @@
+/// @file     sweep.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the "sweep" class.
+
+#include "sweep.hpp"
+
+#include <cmath>
+
+namespace
+{
+// Converting a list of values (empty list = default value):
+std::vector<float> values (
+                           const std::vector<std::string>& loc_item,                                 // List items.
+                           float                           loc_default                               // Default value.
+                          )
+{
+  std::vector<float> value;                                                                          // Values.
+  size_t             i;                                                                              // Index.
+
+  for(i = 0; i < loc_item.size (); i++)
+  {
+    value.push_back (std::stof (loc_item[i]));                                                       // Converting item...
+  }
+
+  if(value.empty ())
+  {
+    value.push_back (loc_default);                                                                   // Setting default value...
+  }
+
+  return value;
+}
+}
+
+sb::sweep::sweep (
+                  std::vector<std::string> loc_T,                                                    // Temperature values.
+                  std::vector<std::string> loc_Hx,                                                   // Longitudinal magnetic field values.
+                  std::vector<std::string> loc_Hz,                                                   // Transverse magnetic field values.
+                  std::vector<std::string> loc_alpha,                                                // Radial exponent values.
+                  std::vector<float>       loc_default,                                              // Default (T, Hx, Hz, alpha).
+                  size_t                   loc_repeats,                                              // Trials per point.
+                  size_t                   loc_burn,                                                 // Trial steps discarded from the averages.
+                  size_t                   loc_jobs,                                                 // Number of jobs.
+                  size_t                   loc_job                                                   // Job index.
+                 )
+{
+  size_t batches;                                                                                    // Number of batches (all jobs).
+
+  T_axis     = values (loc_T, loc_default[0]);                                                       // Setting temperature axis...
+  Hx_axis    = values (loc_Hx, loc_default[1]);                                                      // Setting longitudinal magnetic field axis...
+  Hz_axis    = values (loc_Hz, loc_default[2]);                                                      // Setting transverse magnetic field axis...
+  alpha_axis = values (loc_alpha, loc_default[3]);                                                   // Setting radial exponent axis...
+  repeats    = (loc_repeats > 0) ? loc_repeats : 1;                                                  // Setting trials per point...
+  burn       = loc_burn;                                                                             // Setting burn-in steps...
+  batches    = Hx_axis.size ()*Hz_axis.size ()*alpha_axis.size ();                                   // Computing number of batches...
+  first      = batches*loc_job/loc_jobs;                                                             // Setting first batch of this job...
+  last       = batches*(loc_job + 1)/loc_jobs;                                                       // Setting last batch of this job...
+
+  sz_stat.resize (points ());                                                                        // Sizing <sz> statistics...
+  energy_sum.assign (points (), 0.0);                                                                // Resetting energy summation...
+  finished.assign (points (), 0);                                                                    // Resetting number of finished trials...
+  decays.assign (points (), 0);                                                                      // Resetting number of decayed trials...
+}
+
+size_t sb::sweep::axis (
+                        size_t loc_batch,                                                            // Batch index.
+                        size_t loc_axis                                                              // Axis (0 = Hx, 1 = Hz, 2 = alpha).
+                       )
+{
+  size_t row   = loc_batch/Hx_axis.size ();                                                          // Hx row (fixed Hz and alpha).
+  size_t plane = row/Hz_axis.size ();                                                                // Hz plane (fixed alpha).
+  size_t index;                                                                                      // Axis index.
+
+  // Reversing every other row and plane (serpentine order, consecutive batches are neighbours):
+  if(loc_axis == 0)
+  {
+    index = loc_batch%Hx_axis.size ();                                                               // Getting Hx index...
+    return (row%2 == 0) ? index : Hx_axis.size () - 1 - index;
+  }
+
+  if(loc_axis == 1)
+  {
+    index = row%Hz_axis.size ();                                                                     // Getting Hz index...
+    return (plane%2 == 0) ? index : Hz_axis.size () - 1 - index;
+  }
+
+  return plane;
+}
+
+size_t sb::sweep::points ()
+{
+  return T_axis.size ()*Hx_axis.size ()*Hz_axis.size ()*alpha_axis.size ();
+}
+
+size_t sb::sweep::trials ()
+{
+  return (last - first)*T_axis.size ()*repeats;
+}
+
+size_t sb::sweep::temperatures ()
+{
+  return T_axis.size ();
+}
+
+size_t sb::sweep::point (
+                         size_t loc_trial                                                            // Trial index (this job).
+                        )
+{
+  return first*T_axis.size () + loc_trial/repeats;
+}
+
+size_t sb::sweep::batch (
+                         size_t loc_point                                                            // Point index.
+                        )
+{
+  return loc_point/T_axis.size ();
+}
+
+size_t sb::sweep::batch_end (
+                             size_t loc_trial                                                        // Trial index (this job).
+                            )
+{
+  return (batch (point (loc_trial)) + 1 - first)*T_axis.size ()*repeats;
+}
+
+size_t sb::sweep::rung (
+                        size_t loc_point                                                             // Point index.
+                       )
+{
+  return loc_point%T_axis.size ();
+}
+
+float sb::sweep::T (
+                    size_t loc_point                                                                 // Point index.
+                   )
+{
+  return T_axis[rung (loc_point)];
+}
+
+float sb::sweep::Hx (
+                     size_t loc_point                                                                // Point index.
+                    )
+{
+  return Hx_axis[axis (batch (loc_point), 0)];
+}
+
+float sb::sweep::Hz (
+                     size_t loc_point                                                                // Point index.
+                    )
+{
+  return Hz_axis[axis (batch (loc_point), 1)];
+}
+
+float sb::sweep::alpha (
+                        size_t loc_point                                                             // Point index.
+                       )
+{
+  return alpha_axis[axis (batch (loc_point), 2)];
+}
+
+void sb::sweep::add (
+                     size_t loc_point,                                                               // Point index.
+                     size_t loc_step,                                                                // Trial step.
+                     float  loc_sz,                                                                  // Average z-spin.
+                     float  loc_energy                                                               // Energy per node.
+                    )
+{
+  if(loc_step < burn)
+  {
+    return;
+  }
+
+  sz_stat[loc_point].add (loc_sz);                                                                   // Accumulating <sz>...
+  energy_sum[loc_point] += loc_energy;                                                               // Accumulating energy...
+}
+
+void sb::sweep::finish (
+                        size_t loc_point,                                                            // Point index.
+                        bool   loc_decayed                                                           // "true" = trial decayed.
+                       )
+{
+  finished[loc_point]++;                                                                             // Updating number of finished trials...
+
+  if(loc_decayed)
+  {
+    decays[loc_point]++;                                                                             // Updating number of decayed trials...
+  }
+}
+
+size_t sb::sweep::first_point ()
+{
+  return first*T_axis.size ();
+}
+
+size_t sb::sweep::last_point ()
+{
+  return last*T_axis.size ();
+}
+
+size_t sb::sweep::trials (
+                          size_t loc_point                                                           // Point index.
+                         )
+{
+  return finished[loc_point];
+}
+
+float sb::sweep::sz (
+                     size_t loc_point                                                                // Point index.
+                    )
+{
+  if(sz_stat[loc_point].samples () == 0.0)
+  {
+    return NAN;
+  }
+
+  return (float)sz_stat[loc_point].mean ();
+}
+
+float sb::sweep::sz_stderr (
+                            size_t loc_point                                                         // Point index.
+                           )
+{
+  if(sz_stat[loc_point].samples () < 2.0)
+  {
+    return NAN;
+  }
+
+  return (float)sz_stat[loc_point].error ();
+}
+
+float sb::sweep::sz_tau (
+                         size_t loc_point                                                            // Point index.
+                        )
+{
+  if(sz_stat[loc_point].samples () < 2.0)
+  {
+    return NAN;
+  }
+
+  return (float)sz_stat[loc_point].tau ();
+}
+
+float sb::sweep::sz_samples (
+                             size_t loc_point                                                        // Point index.
+                            )
+{
+  return (float)sz_stat[loc_point].effective_samples ();
+}
+
+float sb::sweep::energy (
+                         size_t loc_point                                                            // Point index.
+                        )
+{
+  if(sz_stat[loc_point].samples () == 0.0)
+  {
+    return NAN;
+  }
+
+  return (float)(energy_sum[loc_point]/sz_stat[loc_point].samples ());
+}
+
+float sb::sweep::decayed (
+                          size_t loc_point                                                           // Point index.
+                         )
+{
+  if(finished[loc_point] == 0)
+  {
+    return NAN;
+  }
+
+  return (float)decays[loc_point]/finished[loc_point];
+}
+
+sb::sweep::~sweep ()
+{
+  // Doing nothing!
+}
@@ -0,0 +1,146 @@
+/// @file     tempering.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the "tempering" class.
+
+#include "tempering.hpp"
+
+#include <cmath>
+#include <sstream>
+
+sb::tempering::tempering (
+                          float        loc_T_min,                                                    // Lowest temperature.
+                          float        loc_T_max,                                                    // Highest temperature.
+                          size_t       loc_replicas,                                                 // Number of replicas.
+                          unsigned int loc_seed                                                      // Random seed.
+                         )
+{
+  size_t k;                                                                                          // Rung index.
+
+  for(k = 0; k < loc_replicas; k++)
+  {
+    if(loc_replicas == 1)
+    {
+      ladder.push_back (loc_T_min);                                                                  // Setting single rung...
+    }
+    else
+    {
+      ladder.push_back (
+                        loc_T_min*(float)pow (loc_T_max/loc_T_min, (double)k/(loc_replicas - 1))
+                       );                                                                            // Setting geometric ladder rung...
+    }
+
+    rung.push_back (k);                                                                              // Setting replica at rung...
+  }
+
+  attempts.assign (loc_replicas, 0);                                                                 // Resetting swap attempts...
+  accepts.assign (loc_replicas, 0);                                                                  // Resetting accepted swaps...
+  generator.seed (loc_seed);                                                                         // Seeding random generator...
+  parity = 0;                                                                                        // Starting from even pairs...
+}
+
+void sb::tempering::temperature (
+                                 std::vector<float>& loc_temperature                                 // Replica temperatures.
+                                )
+{
+  size_t k;                                                                                          // Rung index.
+
+  loc_temperature.resize (rung.size ());                                                             // Resizing replica temperatures...
+
+  for(k = 0; k < rung.size (); k++)
+  {
+    loc_temperature[rung[k]] = ladder[k];                                                            // Setting replica temperature...
+  }
+}
+
+size_t sb::tempering::swap (
+                            const std::vector<float>& loc_energy,                                    // Replica energies.
+                            std::vector<float>&       loc_temperature                                // Replica temperatures.
+                           )
+{
+  std::uniform_real_distribution<double> flat (0.0, 1.0);                                            // Flat distribution.
+  size_t                                 k;                                                          // Rung index.
+  size_t                                 swaps = 0;                                                  // Accepted swaps.
+  size_t                                 a;                                                          // Replica at rung "k".
+  size_t                                 b;                                                          // Replica at rung "k + 1".
+  double                                 delta;                                                      // Acceptance exponent.
+
+  for(k = parity; (k + 1) < rung.size (); k += 2)
+  {
+    a     = rung[k];                                                                                 // Getting replica at rung "k"...
+    b     = rung[k + 1];                                                                             // Getting replica at rung "k + 1"...
+    delta = (1.0/ladder[k] - 1.0/ladder[k + 1])*((double)loc_energy[a] - (double)loc_energy[b]);     // Computing acceptance exponent...
+    attempts[k]++;                                                                                   // Updating swap attempts...
+
+    if((delta >= 0.0) || (flat (generator) < exp (delta)))
+    {
+      rung[k]     = b;                                                                               // Swapping replicas...
+      rung[k + 1] = a;                                                                               // Swapping replicas...
+      accepts[k]++;                                                                                  // Updating accepted swaps...
+      swaps++;                                                                                       // Updating accepted swaps...
+    }
+  }
+
+  parity = 1 - parity;                                                                               // Alternating rung pair parity...
+  temperature (loc_temperature);                                                                     // Updating replica temperatures...
+
+  return swaps;
+}
+
+float sb::tempering::acceptance (
+                                 size_t loc_k                                                        // Rung index.
+                                )
+{
+  if(attempts[loc_k] == 0)
+  {
+    return 0.0f;
+  }
+
+  return (float)accepts[loc_k]/attempts[loc_k];
+}
+
+float sb::tempering::rung_temperature (
+                                       size_t loc_k                                                  // Rung index.
+                                      )
+{
+  return ladder[loc_k];
+}
+
+size_t sb::tempering::rungs ()
+{
+  return ladder.size ();
+}
+
+std::string sb::tempering::state ()
+{
+  std::stringstream text;                                                                            // Ladder state.
+  size_t            k;                                                                               // Rung index.
+
+  for(k = 0; k < rung.size (); k++)
+  {
+    text << rung[k] << " " << attempts[k] << " " << accepts[k] << " ";                               // Storing rung state...
+  }
+
+  text << parity << " " << generator;                                                                // Storing parity and random generator state...
+
+  return text.str ();
+}
+
+void sb::tempering::restore (
+                             std::string loc_state                                                   // Ladder state.
+                            )
+{
+  std::stringstream text (loc_state);                                                                // Ladder state.
+  size_t            k;                                                                               // Rung index.
+
+  for(k = 0; k < rung.size (); k++)
+  {
+    text >> rung[k] >> attempts[k] >> accepts[k];                                                    // Restoring rung state...
+  }
+
+  text >> parity >> generator;                                                                       // Restoring parity and random generator state...
+}
+
+sb::tempering::~tempering ()
+{
+  // Doing nothing!
+}
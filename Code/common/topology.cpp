@@ -0,0 +1,103 @@
+/// @file     topology.cpp
+/// @date     16OCT2026
+/// @brief    Definition of the "topology" class.
+
+#include "topology.hpp"
+#include "checkpoint.hpp"
+
+#include <sstream>
+#include <iomanip>
+
+namespace
+{
+// Getting a vector section (sized from the section itself):
+template <typename T>
+void get_vector (
+                 sb::checkpoint& loc_cache,                                                          // Cache.
+                 std::string     loc_key,                                                            // Section name.
+                 std::vector<T>& loc_data                                                            // Section data.
+                )
+{
+  loc_data.resize (loc_cache.size (loc_key)/sizeof (T));                                             // Sizing data...
+  loc_cache.get (loc_key, loc_data.data (), loc_data.size ()*sizeof (T));                            // Getting data...
+}
+}
+
+sb::topology::topology ()
+{
+  side_x_nodes = 0;                                                                                  // Resetting number of nodes along "x" side...
+  side_y_nodes = 0;                                                                                  // Resetting number of nodes along "y" side...
+  elements     = 0;                                                                                  // Resetting number of element vertices...
+  groups       = 0;                                                                                  // Resetting number of group vertices...
+}
+
+std::string sb::topology::file_name (
+                                     std::string loc_directory,                                      // Cache directory.
+                                     uint64_t    loc_hash                                            // Mesh file hash.
+                                    )
+{
+  std::stringstream name;                                                                            // File name.
+
+  name << loc_directory << TOPOLOGY_FILE << std::hex << std::setw (16) << std::setfill ('0')
+       << loc_hash << "." << TOPOLOGY_EXT;                                                           // Building file name...
+
+  return name.str ();
+}
+
+bool sb::topology::load (
+                         std::string loc_file_name,                                                  // Cache file name.
+                         uint64_t    loc_hash                                                        // Mesh file hash.
+                        )
+{
+  sb::checkpoint cache;                                                                              // Cache.
+  uint64_t       hash;                                                                               // Cached mesh file hash.
+
+  if(!cache.load (loc_file_name) || !cache.has ("hash"))
+  {
+    return false;
+  }
+
+  cache.get ("hash", &hash, sizeof (hash));                                                          // Getting mesh file hash...
+
+  if(hash != loc_hash)
+  {
+    return false;
+  }
+
+  get_vector (cache, "node", node);                                                                  // Getting node indices...
+  get_vector (cache, "position", position);                                                          // Getting node coordinates...
+  get_vector (cache, "neighbour", neighbour);                                                        // Getting neighbour indices...
+  get_vector (cache, "offset", offset);                                                              // Getting neighbour offsets...
+  get_vector (cache, "border", border);                                                              // Getting border nodes...
+  cache.get ("side_x_nodes", &side_x_nodes, sizeof (side_x_nodes));                                  // Getting number of nodes along "x" side...
+  cache.get ("side_y_nodes", &side_y_nodes, sizeof (side_y_nodes));                                  // Getting number of nodes along "y" side...
+  cache.get ("elements", &elements, sizeof (elements));                                              // Getting number of element vertices...
+  cache.get ("groups", &groups, sizeof (groups));                                                    // Getting number of group vertices...
+
+  return true;
+}
+
+void sb::topology::save (
+                         std::string loc_file_name,                                                  // Cache file name.
+                         uint64_t    loc_hash                                                        // Mesh file hash.
+                        )
+{
+  sb::checkpoint cache;                                                                              // Cache.
+
+  cache.set ("hash", &loc_hash, sizeof (loc_hash));                                                  // Setting mesh file hash...
+  cache.set ("node", node.data (), node.size ()*sizeof (int));                                       // Setting node indices...
+  cache.set ("position", position.data (), position.size ()*sizeof (float));                         // Setting node coordinates...
+  cache.set ("neighbour", neighbour.data (), neighbour.size ()*sizeof (int));                        // Setting neighbour indices...
+  cache.set ("offset", offset.data (), offset.size ()*sizeof (int));                                 // Setting neighbour offsets...
+  cache.set ("border", border.data (), border.size ()*sizeof (int));                                 // Setting border nodes...
+  cache.set ("side_x_nodes", &side_x_nodes, sizeof (side_x_nodes));                                  // Setting number of nodes along "x" side...
+  cache.set ("side_y_nodes", &side_y_nodes, sizeof (side_y_nodes));                                  // Setting number of nodes along "y" side...
+  cache.set ("elements", &elements, sizeof (elements));                                              // Setting number of element vertices...
+  cache.set ("groups", &groups, sizeof (groups));                                                    // Setting number of group vertices...
+  cache.save (loc_file_name);                                                                        // Saving cache...
+}
+
+sb::topology::~topology ()
+{
+  // Doing nothing!
+}
@@ -0,0 +1,1863 @@
+/// @file
+
+#define INTEROP       false                                                                          // "false" = no OpenGL-OpenCL interoperability (no window).
+
+// INCLUDES:
+#include "nu.hpp"                                                                                    // Neutrino's header file.
+#include "spin_bubble.hpp"                                                                           // Spin-bubble common definitions.
+#include "coupling.hpp"                                                                              // Coupling table.
+#include "colouring.hpp"                                                                             // Graph colouring.
+#include "config.hpp"                                                                                // Run configuration.
+#include "tempering.hpp"                                                                             // Parallel tempering.
+#include "snapshot.hpp"                                                                              // Binary snapshots.
+#include "checkpoint.hpp"                                                                            // Checkpoint/restart.
+#include "lattice.hpp"                                                                               // Periodic lattice generator.
+#include "topology.hpp"                                                                              // Mesh topology cache.
+#include "structured.hpp"                                                                            // Structured grid detection.
+#include "partition.hpp"                                                                             // Mesh partition.
+#include "halo.hpp"                                                                                  // Multi-device halo exchange.
+#include "reorder.hpp"                                                                               // Node reordering.
+#include "profiler.hpp"                                                                              // Kernel profiling.
+#include "specialise.hpp"                                                                            // Kernel specialisation.
+#include "sweep.hpp"                                                                                 // Parameter sweep.
+#include "long_range.hpp"                                                                            // Long-range coupling.
+#include "statistics.hpp"                                                                            // Streaming statistics.
+#include "compact.hpp"                                                                               // Compact storage.
+#include "angle.hpp"                                                                                 // 16-bit fixed-point angles.
+
+int main (
+          int    argc,                                                                               // Number of command line arguments.
+          char** argv                                                                                // Command line arguments.
+         )
+{
+  // CONFIGURATION:
+  sb::config*         cfg             = new sb::config ();                                           // Run configuration.
+
+  // PROFILING (created first: time to first batch includes device and mesh setup):
+  sb::profiler*       prof            = new sb::profiler ();                                         // Profiler.
+
+  // TIMESTAMP:
+  std::string         timestamp;                                                                     // Timestamp.
+
+  // INDICES:
+  size_t              i;                                                                             // Index [#].
+  size_t              j;                                                                             // Index [#].
+  size_t              j_min;                                                                         // Index [#].
+  size_t              j_max;                                                                         // Index [#].
+  size_t              c;                                                                             // Colour index [#].
+  size_t              k;                                                                             // Observable index [#].
+  size_t              q;                                                                             // Replica index [#].
+  unsigned int        time_index;                                                                    // Index [#].
+  unsigned int        trial_index;                                                                   // Index [#].
+  unsigned int        trial_limit;                                                                   // First trial not available yet (next sweep batch) [#].
+  unsigned int        step_index;                                                                    // Step index (since start) [#].
+  size_t              slot;                                                                          // Observable ring slot [#].
+  std::string         trial_text;                                                                    // Trial text, corresponding to trial index.
+  int                 steps;                                                                         // Steps per trial [#].
+  int                 trials;                                                                        // Number of trials [#].
+  size_t              replicas;                                                                      // Number of replicas [#].
+  size_t              running;                                                                       // Number of replicas with trials left [#].
+  size_t              done;                                                                          // Number of replicas with a finished trial [#].
+  std::vector<float>  energy;                                                                        // Replica energies.
+
+  // SEED:
+  unsigned int        seed;                                                                          // Seed for C++ rand().
+
+  // PARSING CONFIGURATION:
+  cfg->parse (argc, argv);                                                                           // Parsing command line (and configuration file)...
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////// SNAPSHOT TEXT CONVERTER /////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  if(cfg->has ("convert"))
+  {
+    sb::snapshot_reader* snapshot_in = new sb::snapshot_reader ();                                   // Snapshot reader.
+    nu::logfile*         text        = new nu::logfile ();                                           // Text file.
+    std::string          name        = cfg->get ("convert", "");                                     // Snapshot file name.
+    const float*         field;                                                                      // Snapshot field.
+
+    if(!snapshot_in->open (name))
+    {
+      std::cerr << "Error: cannot open " << name << "." << std::endl;                                // Printing message...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    name = name.substr (0, name.size () - std::string (SNAPSHOT_EXT).size () - 1);                   // Removing extension...
+
+    for(k = 0; k < snapshot_in->records (); k++)
+    {
+      trial_text = std::string ("_#") + std::to_string (snapshot_in->record (k)->trial + 1);         // Setting trial text...
+      field      = snapshot_in->theta (k);                                                           // Getting snapshot field...
+
+      text->open (name + trial_text, DLOAD_EXT, DLOAD_HEAD, "\t", nu::WRITE);                        // Opening text file...
+      text->write ("#index");                                                                        // Logging header...
+      text->write ("#x");                                                                            // Logging header...
+      text->write ("#y");                                                                            // Logging header...
+      text->write ("#theta(x,y)");                                                                   // Logging header...
+      text->endline ();                                                                              // Logging header...
+
+      for(i = 0; i < snapshot_in->nodes (); i++)
+      {
+        text->write (snapshot_in->index ()[i]);                                                      // Logging node index...
+        text->write (snapshot_in->x ()[i]);                                                          // Logging node x-coordinate...
+        text->write (snapshot_in->y ()[i]);                                                          // Logging node y-coordinate...
+        text->write (field[i]);                                                                      // Logging theta(x,y)...
+        text->endline ();                                                                            // Ending log line...
+      }
+
+      text->close (nu::WRITE);                                                                       // Closing text file...
+    }
+
+    std::cout << snapshot_in->records () << " snapshots converted." << std::endl;                    // Printing message...
+
+    delete snapshot_in;                                                                              // Deleting snapshot reader...
+    delete text;                                                                                     // Deleting log file object...
+    delete cfg;                                                                                      // Deleting configuration...
+
+    return 0;
+  }
+
+  // BINDING THE PARTITION TO ITS DEVICE (multi-device runs, before the OpenCL context is created):
+  if(!sb::bind_device (cfg->list ("device_index", ""), cfg->get ("partition", 0)))
+  {
+    std::cerr << "Error: device_index needs one device index per partition." << std::endl;           // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  // OPENCL:
+  nu::opencl*         cl              = new nu::opencl (
+                                                        cfg->get ("device", "gpu") == "cpu" ?
+                                                        nu::CPU : nu::GPU
+                                                       );                                            // OpenCL context.
+  nu::kernel*         K0              = new nu::kernel ();                                           // OpenCL kernel array.
+  nu::kernel*         K1              = new nu::kernel ();                                           // OpenCL kernel array.
+  nu::kernel*         K2              = new nu::kernel ();                                           // OpenCL kernel array.
+  nu::kernel*         K3              = new nu::kernel ();                                           // OpenCL kernel array.
+  std::vector<nu::kernel*> K4;                                                                       // OpenCL kernel array (one per colour class).
+  nu::kernel*         K5              = new nu::kernel ();                                           // OpenCL kernel array.
+  nu::kernel*         K6              = new nu::kernel ();                                           // OpenCL kernel array.
+  nu::kernel*         K7              = new nu::kernel ();                                           // OpenCL kernel array.
+  nu::kernel*         K8              = new nu::kernel ();                                           // OpenCL kernel array.
+  nu::kernel*         K9              = new nu::kernel ();                                           // OpenCL kernel array.
+  nu::kernel*         K10             = new nu::kernel ();                                           // OpenCL kernel array.
+  nu::kernel*         K11             = new nu::kernel ();                                           // OpenCL kernel array.
+  std::string         options;                                                                       // OpenCL JIT build options.
+  bool                specialise      = cfg->get ("specialise", true);                               // "true" = run constants as JIT build options.
+  nu::float4*         position        = new nu::float4 (0);                                          // Position [m].
+  nu::int1*           neighbour       = new nu::int1 (1);                                            // Neighbour.
+  nu::int1*           offset          = new nu::int1 (2);                                            // Offset.
+  nu::int1*           theta           = new nu::int1 (3);                                            // Theta (16-bit fixed point, see angle.hpp).
+  nu::int1*           theta_int       = new nu::int1 (4);                                            // Theta (intermediate value, 16-bit fixed point).
+  nu::int4*           state_theta     = new nu::int4 (5);                                            // Random generator state.
+  nu::int4*           state_threshold = new nu::int4 (6);                                            // Random generator state.
+  nu::float1*         spin_z_partial  = new nu::float1 (7);                                          // z-spin partial summation.
+  nu::float1*         spin_z2_partial = new nu::float1 (8);                                          // z-spin square partial summation.
+  nu::int1*           m_overflow      = new nu::int1 (9);                                            // Rejection sampling iterations (16-bit counts).
+  nu::int1*           m_overflow_part = new nu::int1 (10);                                           // Rejection sampling overflow partial summation.
+  nu::float1*         parameter       = new nu::float1 (11);                                         // Parameters array.
+  nu::float1*         coupling        = new nu::float1 (12);                                         // Coupling table.
+  nu::int1*           colour_node     = new nu::int1 (13);                                           // Nodes sorted by colour.
+  nu::int1*           colour_offset   = new nu::int1 (14);                                           // Colour class offsets.
+  nu::float1*         observable      = new nu::float1 (15);                                         // Observables (ring buffer).
+  nu::int1*           step            = new nu::int1 (16);                                           // Step counter.
+  nu::int4*           replica         = new nu::int4 (17);                                           // Replica state (step, trial, status, decay).
+  nu::float1*         energy_partial  = new nu::float1 (18);                                         // Energy partial summation.
+  nu::float1*         temperature     = new nu::float1 (19);                                         // Replica temperature.
+  nu::int1*           grid_node       = new nu::int1 (20);                                           // Structured grid (node of each grid cell).
+  nu::float1*         spectrum        = new nu::float1 (21);                                         // Long-range field spectrum.
+  nu::float1*         coupling_spectrum = new nu::float1 (22);                                       // Long-range coupling spectrum.
+  nu::float1*         long_range      = new nu::float1 (23);                                         // Long-range field.
+  nu::float1*         halo            = new nu::float1 (24);                                         // Halo values (boundary, then ghost theta).
+  nu::int1*           halo_node       = new nu::int1 (25);                                           // Boundary nodes (slice indices).
+  nu::float1*         iteration_part  = new nu::float1 (26);                                         // Rejection sampling iterations partial summation.
+  std::vector<float>  theta_value;                                                                   // Theta [rad] (host, expanded from "theta").
+  std::vector<float>  theta_int_value;                                                               // Theta (intermediate value) [rad] (host).
+
+  // MESH:
+  nu::mesh*           vacuum          = nullptr;                                                     // False vacuum domain (GMSH mesh).
+  sb::lattice*        grid            = new sb::lattice ();                                          // False vacuum domain (generated lattice).
+  size_t              lattice_x       = cfg->get ("lattice_x", 0);                                   // Generated lattice nodes along "x" (0 = GMSH mesh).
+  size_t              lattice_y       = cfg->get ("lattice_y", 0);                                   // Generated lattice nodes along "y" (0 = square).
+  size_t              lattice_stencil = cfg->get ("lattice_stencil", 8);                             // Generated lattice neighbours per node (4 or 8).
+  std::vector<int>    node_index;                                                                    // Node indices.
+  std::string         mesh_file       = cfg->get ("mesh", MESH);                                     // GMSH mesh file name.
+  uint64_t            mesh_hash_file;                                                                // GMSH mesh file hash.
+  sb::topology*       topo            = new sb::topology ();                                         // GMSH mesh topology (cached).
+  std::string         topology_file;                                                                 // Topology cache file name.
+  size_t              nodes;                                                                         // Number of nodes.
+  size_t              neighbours;                                                                    // Number of neighbours.
+  size_t              side_x_nodes;                                                                  // Number of nodes in "x" direction [#].
+  size_t              side_y_nodes;                                                                  // Number of nodes in "x" direction [#].
+  float               x_min         = -1.0f;                                                         // "x_min" spatial boundary [m].
+  float               x_max         = +1.0f;                                                         // "x_max" spatial boundary [m].
+  std::vector<float>  node_x;                                                                        // Node "x" coordinates [m].
+  std::vector<float>  node_y;                                                                        // Node "y" coordinates [m].
+  std::vector<float>  edge;                                                                          // Edge lengths (periodic) [m].
+  std::string         reorder       = cfg->get ("reorder", "none");                                  // Node reordering ("none", "rcm" or "morton").
+  std::vector<int>    order;                                                                         // Node order (order[internal] = mesh node).
+  std::vector<float>  export_x;                                                                      // Node "x" coordinates, mesh order [m].
+  std::vector<float>  export_y;                                                                      // Node "y" coordinates, mesh order [m].
+  size_t              colours;                                                                       // Number of graph colours [#].
+  size_t              colour_nodes;                                                                  // Largest colour class size [#].
+  bool                structured;                                                                    // "true" = regular periodic grid (structured stencil kernel).
+  size_t              grid_columns;                                                                  // Number of grid columns [#].
+  size_t              grid_rows;                                                                     // Number of grid rows [#].
+  size_t              grid_stencil;                                                                  // Grid neighbours per node [#].
+  bool                long_mode       = cfg->get ("long_range", false);                              // "true" = full power-law coupling (FFT convolution).
+  float               spacing         = 0.0f;                                                        // Grid spacing (in units of ds).
+  bool                compact         = cfg->get ("compact", false);                                 // "true" = 16-bit neighbour indices (offsets from the node).
+  size_t              parts           = cfg->get ("partitions", 1);                                  // Number of partitions (one process per device) [#].
+  size_t              part            = cfg->get ("partition", 0);                                   // Partition of this process.
+  sb::partition*      domain          = new sb::partition ();                                        // Owned and ghost nodes of this process.
+  sb::halo*           exchange        = new sb::halo ();                                             // Halo exchange (multi-device runs).
+  std::string         halo_file       = cfg->get ("halo", HALO_FILE);                                // Halo exchange file name.
+  size_t              rows;                                                                          // Number of CSR rows (owned nodes) [#].
+  size_t              slice;                                                                         // Theta slice size (owned and ghost nodes) [#].
+  std::vector<float>  observable_part;                                                               // Observables of this partition.
+  const float*        field;                                                                         // Theta of all nodes (download).
+  float               dx;                                                                            // x-axis mesh spatial size [m].
+
+  // SIMULATION VARIABLES:
+  float               Hx            = cfg->get ("Hx", HX_INIT);                                      // Longitudinal magnetic field.
+  float               Hz            = cfg->get ("Hz", HZ_INIT);                                      // Transverse magnetic field.
+  float               T             = cfg->get ("T", T_INIT);                                        // Temperature.
+  float               alpha         = cfg->get ("alpha", ALPHA_INIT);                                // Radial exponent.
+  float               theta_start   = cfg->get ("theta", (float)THETA_INIT);                         // Theta angle.
+  float               spin_z_avg    = 0.0f;                                                          // Average z-spin.
+  float               spin_z_stderr = 0.0f;                                                          // Standard error z-spin.
+  float               m_level       = 0.0f;                                                          // Rejection sampling overflow level.
+  float               m_max         = cfg->get ("m_max", (float)M_MAX);                              // Maximum allowed number of rejections.
+  float               ds;                                                                            // Simulation space step [m].
+  float               dt;                                                                            // Simulation time step [s].
+  size_t              depth         = cfg->get ("readback", OBSERVABLE_DEPTH);                       // Observable ring depth (readback interval) [steps].
+  bool                colour_mode   = cfg->get ("update", "jacobi") == "colour";                     // "true" = graph-coloured update, "false" = Jacobi.
+  int                 rng_mode      = (cfg->get ("rng", "philox") == "xoshiro") ?                    // Random generator mode.
+                                      RNG_XOSHIRO : RNG_PHILOX;
+  int                 sampler       = (cfg->get ("sampler", "rejection") == "heatbath") ?            // Single-site sampler.
+                                      SAMPLER_HEATBATH : SAMPLER_REJECTION;
+  bool                grid_mode     = cfg->get ("structured", "auto") == "auto";                     // "true" = structured stencil kernel on regular periodic grids.
+  bool                decay         = cfg->get ("decay", false);                                     // "true" = end each trial when <sz> crosses the decay threshold.
+  float               decay_sz      = cfg->get ("decay_sz", DECAY_SZ_INIT);                          // Decay threshold on <sz>.
+  bool                verbose       = cfg->get ("verbose", false);                                   // "true" = print per-node diagnostics.
+  bool                tempering     = cfg->get ("tempering", false);                                 // "true" = parallel tempering across a temperature ladder.
+  float               T_min         = cfg->get ("T_min", T);                                         // Lowest ladder temperature.
+  float               T_max         = cfg->get ("T_max", T);                                         // Highest ladder temperature.
+  sb::tempering*      ladder        = nullptr;                                                       // Temperature ladder.
+
+  // PARAMETER SWEEP:
+  bool                sweeping      = cfg->get ("sweep", false);                                     // "true" = parameter sweep over the sweep_* lists.
+  bool                warm          = cfg->get ("sweep_warm", true);                                 // "true" = warm-start each point from the previous batch.
+  bool                energy_mode   = cfg->get ("energy", false) || tempering || sweeping;           // "true" = energy reduction (logged, tempering, sweeps).
+  size_t              jobs          = cfg->get ("sweep_jobs", 1);                                    // Number of sweep jobs (one process per device) [#].
+  size_t              job           = cfg->get ("sweep_job", 0);                                     // Sweep job of this process.
+  sb::sweep*          plan          = nullptr;                                                       // Parameter sweep.
+  size_t              point;                                                                         // Sweep point [#].
+  std::vector<std::vector<float> > warm_theta;                                                       // Warm-start theta per temperature (previous batch).
+  std::vector<std::vector<float> > warm_next;                                                        // Warm-start theta per temperature (current batch).
+  const std::vector<float>* start;                                                                   // Initial theta of a trial.
+
+  // STATISTICS:
+  float               target_error  = cfg->get ("target_error", 0.0f);                               // Target stderr of <sz> per trial (0 = fixed length).
+  size_t              burn          = cfg->get ("burn", 0);                                          // Trial steps discarded from the statistics.
+  std::vector<sb::statistics> stat;                                                                  // <sz> statistics, per replica.
+  std::vector<double> stat_state;                                                                    // <sz> statistics state (checkpoint).
+  std::vector<double> stat_replica;                                                                  // <sz> statistics state of a replica.
+
+  // OUTPUT:
+  std::string         output        = cfg->get ("output", LOG_HOME);                                 // Output directory.
+
+  // DATA LOG:
+  nu::logfile*        log           = new nu::logfile ();                                            // Log file.
+  nu::logfile*        decay_log     = new nu::logfile ();                                            // Decay log file.
+  nu::logfile*        sweep_log     = new nu::logfile ();                                            // Sweep result table.
+  nu::logfile*        stat_log      = new nu::logfile ();                                            // Statistics log file.
+
+  // PROFILING:
+  bool                profile       = cfg->get ("profile", false);                                   // "true" = per-kernel and stage timing, timing log.
+  nu::kernel_mode     launch;                                                                        // Kernel launch mode (blocking when profiling).
+  double              sweeps;                                                                        // Sweeps per second.
+  double              iterations;                                                                    // Rejection sampling iterations summation.
+  size_t              counted;                                                                       // Running replica steps of the observable ring [#].
+  double              traffic;                                                                       // Estimated device memory traffic per sweep [bytes].
+  bool                first_batch   = true;                                                          // "true" = first batch not done yet.
+
+  // DATA DLOAD:
+  sb::snapshot_writer* snapshot     = new sb::snapshot_writer ();                                    // Download snapshot file.
+  std::vector<float>  snapshot_parameter;                                                            // Download snapshot parameters.
+  std::vector<float>  export_theta;                                                                  // Download theta, mesh order.
+  std::vector<int>    export_state_theta;                                                            // Download random generator state, mesh order.
+  std::vector<int>    export_state_threshold;                                                        // Download random generator state, mesh order.
+  uint64_t            hash;                                                                          // Mesh hash.
+
+  // CHECKPOINT:
+  sb::checkpoint*     ckpt          = new sb::checkpoint ();                                         // Checkpoint.
+  std::string         ckpt_file     = cfg->get ("checkpoint", output + CKPT_FILE + "." + CKPT_EXT);  // Checkpoint file name.
+  int                 ckpt_trials   = cfg->get ("checkpoint_trials", 0);                             // Checkpoint interval [trials] (0 = never).
+  int                 ckpt_time     = cfg->get ("checkpoint_time", 0);                               // Checkpoint interval [s] (0 = never).
+  std::string         restart_file  = cfg->get ("restart", "");                                      // Restart checkpoint file name.
+  unsigned int        ckpt_trial    = 0;                                                             // Trial index at last checkpoint.
+  time_t              ckpt_clock    = time (NULL);                                                   // Wall-clock time at last checkpoint [s].
+  std::string         ladder_state;                                                                  // Temperature ladder state.
+  uint64_t            ckpt_value;                                                                    // Checkpoint check value.
+
+  // DATA ULOAD;
+  nu::logfile*        upload        = new nu::logfile ();                                            // Upload file.
+  sb::snapshot_reader* snapshot_in  = new sb::snapshot_reader ();                                    // Upload snapshot file.
+  std::string         upload_file   = cfg->get ("upload", "");                                       // Upload file name (snapshot, or text with no extension).
+  std::vector<int>    upload_i;
+  std::vector<float>  upload_x;
+  std::vector<float>  upload_y;
+  std::vector<float>  upload_theta;
+  std::vector<int>    ckpt_order;                                                                    // Checkpoint node order.
+
+  steps           = cfg->get ("steps", TRIALS_INIT);                                                 // Setting steps per trial...
+  trials          = cfg->get ("trials", 1);                                                          // Setting number of trials...
+  replicas        = cfg->get ("replicas", REPLICAS_INIT);                                            // Setting number of replicas...
+
+  if(tempering)
+  {
+    trials = (int)replicas;                                                                          // Setting one trial per ladder rung...
+    std::cout << "tempering: running one trial per replica (trials = " << trials << ")."
+              << std::endl;                                                                          // Printing message...
+  }
+
+  if(sweeping)
+  {
+    if(tempering || (parts > 1) || (job >= jobs) || !restart_file.empty () || (ckpt_trials > 0) ||
+       (ckpt_time > 0))
+    {
+      std::cerr << "Error: parameter sweeps need no tempering, a single partition, "
+                << "sweep_job < sweep_jobs and no checkpoints." << std::endl;                        // Printing message...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    plan   = new sb::sweep (
+                            cfg->list ("sweep_T", ""),
+                            cfg->list ("sweep_Hx", ""),
+                            cfg->list ("sweep_Hz", ""),
+                            cfg->list ("sweep_alpha", ""),
+                            {T, Hx, Hz, alpha},
+                            trials,
+                            burn,
+                            jobs,
+                            job
+                           );                                                                        // Building parameter sweep...
+    trials = (int)plan->trials ();                                                                   // Setting number of trials (all points of this job)...
+
+    if(trials == 0)
+    {
+      std::cerr << "Error: no sweep points left for job " << job << "." << std::endl;                // Printing message...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    point  = plan->point (0);                                                                        // Getting first point...
+    Hx     = plan->Hx (point);                                                                       // Setting longitudinal magnetic field...
+    Hz     = plan->Hz (point);                                                                       // Setting transverse magnetic field...
+    alpha  = plan->alpha (point);                                                                    // Setting radial exponent...
+    warm_theta.resize (plan->temperatures ());                                                       // Sizing warm-start theta...
+    warm_next.resize (plan->temperatures ());                                                        // Sizing warm-start theta...
+    std::cout << "sweep: " << plan->points () << " points, job " << job << "/" << jobs
+              << ": points " << plan->first_point () << " to " << plan->last_point () - 1 << ", "
+              << trials << " trials." << std::endl;                                                  // Printing message...
+
+    if(replicas < plan->batch_end (0))
+    {
+      std::cout << "sweep: " << plan->batch_end (0) << " trials per batch, " << replicas
+                << " replicas (set replicas to run a whole batch at once)." << std::endl;            // Printing message...
+    }
+  }
+
+  if(parts > 1)
+  {
+    if(colour_mode || (rng_mode != RNG_PHILOX) || !cfg->has ("seed") || (part >= parts) ||
+       !restart_file.empty () || (ckpt_trials > 0) || (ckpt_time > 0) || decay)
+    {
+      std::cerr << "Error: multi-device runs need the Jacobi update, the Philox generator, the "
+                << "same explicit seed on all partitions, no checkpoints and no decay detection."
+                << std::endl;                                                                        // Printing message...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    // The structured kernel spans the whole grid, partitions run the CSR kernels:
+    grid_mode = false;                                                                               // Using the CSR kernels...
+  }
+
+  if(long_mode && ((parts > 1) || !grid_mode))
+  {
+    std::cerr << "Error: long-range runs need a single partition and structured = auto."
+              << std::endl;                                                                          // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  if(m_max > ANGLE_COUNT_MAX)
+  {
+    std::cerr << "Error: m_max must not exceed " << ANGLE_COUNT_MAX << " (16-bit iteration counts)."
+              << std::endl;                                                                          // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  cfg->print ();                                                                                     // Printing configuration...
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  ///////////////////////////////////////// DATA INITIALIZATION //////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  if(lattice_x > 0)
+  {
+    // GENERATED LATTICE (no GMSH mesh):
+    grid->generate (lattice_x, (lattice_y > 0) ? lattice_y : lattice_x, lattice_stencil);            // Generating periodic lattice...
+    side_x_nodes    = grid->side_x_nodes;                                                            // Getting number of nodes along "x" side...
+    side_y_nodes    = grid->side_y_nodes;                                                            // Getting number of nodes along "y" side...
+    dx              = grid->ds;                                                                      // x-axis mesh spatial size [m].
+    nodes           = grid->nodes ();                                                                // Getting the number of nodes...
+    position->data.resize (nodes);                                                                   // Sizing node coordinates...
+
+    for(i = 0; i < nodes; i++)
+    {
+      position->data[i] = {grid->x[i], grid->y[i], 0.0f, 1.0f};                                      // Setting node coordinates...
+    }
+
+    neighbour->data.swap (grid->neighbour);                                                          // Setting neighbour indices...
+    offset->data.swap (grid->offset);                                                                // Setting neighbour offsets...
+    node_index.swap (grid->node);                                                                    // Setting node indices...
+    neighbours      = neighbour->data.size ();                                                       // Getting the number of neighbours...
+  }
+  else
+  {
+    // GMSH MESH (processed topology cached by mesh file hash):
+    mesh_hash_file  = sb::file_hash (mesh_file);                                                     // Computing mesh file hash...
+    topology_file   = sb::topology::file_name (output, mesh_hash_file);                              // Setting topology cache file name...
+
+    if(!topo->load (topology_file, mesh_hash_file))
+    {
+      vacuum = new nu::mesh (mesh_file);                                                             // Opening GMSH mesh...
+
+      // MESH "X" SIDE:
+      vacuum->process (SIDE_X_TAG, SIDE_X_DIM, nu::MSH_PNT);                                         // Processing mesh...
+      topo->side_x_nodes = vacuum->node.size ();                                                     // Getting number of nodes along "x" side...
+
+      // MESH "Y" SIDE:
+      vacuum->process (SIDE_Y_TAG, SIDE_Y_DIM, nu::MSH_PNT);                                         // Processing mesh...
+      topo->side_y_nodes = vacuum->node.size ();                                                     // Getting number of nodes along "y" side...
+
+      // MESH SURFACE:
+      vacuum->process (SURFACE_TAG, SURFACE_DIM, nu::MSH_QUA_4);                                     // Processing mesh...
+      topo->node      = vacuum->node;                                                                // Getting node indices...
+      topo->neighbour = vacuum->neighbour;                                                           // Getting neighbour indices...
+      topo->offset    = vacuum->neighbour_offset;                                                    // Getting neighbour offsets...
+      topo->elements  = vacuum->element.size ();                                                     // Getting number of element vertices...
+      topo->groups    = vacuum->group.size ();                                                       // Getting number of group vertices...
+      topo->position.resize (4*vacuum->node_coordinates.size ());                                    // Sizing node coordinates...
+
+      for(i = 0; i < vacuum->node_coordinates.size (); i++)
+      {
+        topo->position[4*i + 0] = vacuum->node_coordinates[i].x;                                     // Getting node "x" coordinate...
+        topo->position[4*i + 1] = vacuum->node_coordinates[i].y;                                     // Getting node "y" coordinate...
+        topo->position[4*i + 2] = vacuum->node_coordinates[i].z;                                     // Getting node "z" coordinate...
+        topo->position[4*i + 3] = vacuum->node_coordinates[i].w;                                     // Getting node "w" coordinate...
+      }
+
+      // MESH BORDER:
+      vacuum->process (BORDER_TAG, BORDER_DIM, nu::MSH_PNT);                                         // Processing mesh...
+      topo->border    = vacuum->node;                                                                // Getting nodes on border...
+
+      topo->save (topology_file, mesh_hash_file);                                                    // Saving topology cache...
+      std::cout << "topology cached to " << topology_file << "." << std::endl;                       // Printing message...
+    }
+
+    side_x_nodes    = topo->side_x_nodes;                                                            // Getting number of nodes along "x" side...
+    side_y_nodes    = topo->side_y_nodes;                                                            // Getting number of nodes along "y" side...
+    dx              = (x_max - x_min)/(side_x_nodes - 1);                                            // x-axis mesh spatial size [m].
+    nodes           = topo->node.size ();                                                            // Getting the number of nodes...
+    position->data.resize (nodes);                                                                   // Sizing node coordinates...
+
+    for(i = 0; i < nodes; i++)
+    {
+      position->data[i] = {
+                           topo->position[4*i + 0],
+                           topo->position[4*i + 1],
+                           topo->position[4*i + 2],
+                           topo->position[4*i + 3]
+                          };                                                                         // Setting node coordinates...
+    }
+
+    neighbour->data.swap (topo->neighbour);                                                          // Setting neighbour indices...
+    offset->data.swap (topo->offset);                                                                // Setting neighbour offsets...
+    node_index.swap (topo->node);                                                                    // Setting node indices...
+    neighbours      = neighbour->data.size ();                                                       // Getting the number of neighbours...
+  }
+
+  // COMPUTING MESH HASH (mesh node order, so that snapshots do not depend on the reordering):
+  for(i = 0; i < nodes; i++)
+  {
+    export_x.push_back (position->data[i].x);                                                        // Getting node "x" coordinate...
+    export_y.push_back (position->data[i].y);                                                        // Getting node "y" coordinate...
+  }
+
+  hash            = sb::mesh_hash (export_x, export_y, neighbour->data, offset->data);               // Computing mesh hash...
+
+  // REORDERING NODES (locality of the CSR neighbour gathers, node indices stay positional):
+  if(reorder == "rcm")
+  {
+    order = sb::rcm_order (neighbour->data, offset->data);                                           // Computing Reverse Cuthill-McKee order...
+  }
+  else if(reorder == "morton")
+  {
+    order = sb::morton_order (export_x, export_y);                                                   // Computing Morton order...
+  }
+  else if(reorder == "none")
+  {
+    order.resize (nodes);                                                                            // Sizing node order...
+
+    for(i = 0; i < nodes; i++)
+    {
+      order[i] = (int)i;                                                                             // Setting identity order...
+    }
+  }
+  else
+  {
+    std::cerr << "Error: unknown node reordering \"" << reorder << "\"." << std::endl;               // Printing message...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  if(reorder != "none")
+  {
+    sb::permute (order, position->data);                                                             // Permuting node coordinates...
+    sb::permute_csr (
+                     order,
+                     neighbour->data,
+                     offset->data,
+                     (lattice_x > 0) ? &grid->length : nullptr
+                    );                                                                               // Permuting neighbour indices and offsets...
+    std::cout << "nodes reordered (" << reorder << ")." << std::endl;                                // Printing message...
+  }
+
+  // COMPUTING PHYSICAL PARAMETERS:
+  ds              = dx;                                                                              // Setting space step [m].
+  dt              = 1.0f;                                                                            // Setting time step [s] (always running).
+  std::cout << "nodes = " << nodes << std::endl;                                                     // Printing message...
+  std::cout << "neighbours = " << neighbours << std::endl;                                           // Printing message...
+
+  // SETTING RANDOM SEED:
+  seed            = (unsigned int)cfg->get ("seed", (int)time (NULL));                               // Generating seed for C++ rand()...
+  srand (seed);                                                                                      // Setting C++ rand() seed...
+
+  // SETTING RANDOM GENERATOR STATES (xoshiro128++ only, Philox is stateless and keeps a placeholder):
+  state_theta->data.resize ((rng_mode == RNG_XOSHIRO) ? nodes*replicas : 1);                         // Sizing random generator state...
+  state_threshold->data.resize (state_theta->data.size ());                                          // Sizing random generator state...
+
+  for(i = 0; i < state_theta->data.size (); i++)
+  {
+    state_theta->data[i]     = {rand (), rand (), rand (), rand ()};                                 // Setting state_sz seed...
+    state_threshold->data[i] = {rand (), rand (), rand (), rand ()};                                 // Setting state_th seed...
+  }
+
+  // SETTING NEUTRINO ARRAYS ("surface" depending):
+  upload_theta.assign (nodes, theta_start);                                                          // Setting initial theta...
+
+  for(i = 0; i < nodes; i++)
+  {
+    // Computing minimum element offset index:
+    if(i == 0)
+    {
+      j_min = 0;                                                                                     // Setting minimum element offset index...
+    }
+    else
+    {
+      j_min = offset->data[i - 1];                                                                   // Setting minimum element offset index...
+    }
+
+    j_max = offset->data[i];                                                                         // Setting maximum element offset index...
+
+    // Printing node neighbours (diagnostics only):
+    if(verbose)
+    {
+      std::cout << "i = " << i << ", node index = " << node_index[i] << ", neighbour indices:";      // Printing message...
+
+      for(j = j_min; j < j_max; j++)
+      {
+        std::cout << " " << neighbour->data[j];                                                      // Printing message...
+      }
+
+      std::cout << std::endl;                                                                        // Printing message...
+    }
+  }
+
+  // SETTING REDUCTION ARRAYS:
+  spin_z_partial->data.assign (REDUCTION_ITEMS*replicas, 0.0f);                                      // Resetting z-spin partial summation...
+  spin_z2_partial->data.assign (REDUCTION_ITEMS*replicas, 0.0f);                                     // Resetting z-spin square partial summation...
+  m_overflow_part->data.assign (REDUCTION_ITEMS*replicas, 0);                                        // Resetting rejection sampling overflow partial summation...
+  energy_partial->data.assign (REDUCTION_ITEMS*replicas, 0.0f);                                      // Resetting energy partial summation...
+  iteration_part->data.assign (REDUCTION_ITEMS*replicas, 0.0f);                                      // Resetting rejection sampling iterations partial summation...
+  observable->data.assign (depth*replicas*OBSERVABLES, 0.0f);                                        // Resetting observables...
+  step->data.assign (2, 0);                                                                          // Resetting step counter and K3 work-groups...
+
+  // SETTING REPLICAS (one trial each, as long as there are trials left):
+  trial_index     = 0;                                                                               // Resetting trial index...
+  step_index      = 0;                                                                               // Resetting step index...
+  running         = 0;                                                                               // Resetting number of running replicas...
+  trial_limit     = sweeping ? plan->batch_end (0) : trials;                                         // Setting trials available (first sweep batch)...
+
+  for(q = 0; q < replicas; q++)
+  {
+    if(trial_index < trial_limit)
+    {
+      replica->data.push_back ({0, (int)trial_index, REPLICA_RUNNING, 0});                           // Assigning trial to replica...
+      trial_index++;                                                                                 // Updating trial index...
+      running++;                                                                                     // Updating number of running replicas...
+    }
+    else
+    {
+      replica->data.push_back ({0, 0, REPLICA_IDLE, 0});                                             // Setting idle replica...
+    }
+  }
+
+  stat.resize (replicas);                                                                            // Sizing <sz> statistics...
+
+  // SETTING REPLICA TEMPERATURES:
+  if(tempering)
+  {
+    ladder = new sb::tempering (T_min, T_max, replicas, seed);                                       // Building temperature ladder...
+    ladder->temperature (temperature->data);                                                         // Setting replica temperatures...
+  }
+  else
+  {
+    temperature->data.assign (replicas, T);                                                          // Setting replica temperatures...
+  }
+
+  if(sweeping)
+  {
+    for(q = 0; q < replicas; q++)
+    {
+      if(replica->data[q].z == REPLICA_RUNNING)
+      {
+        temperature->data[q] = plan->T (plan->point (replica->data[q].y));                           // Setting sweep point temperature...
+      }
+    }
+  }
+
+  // SETTING INITIAL PARAMETERS:
+  parameter->data.push_back (alpha);                                                                 // Setting radial exponent parameter...
+  parameter->data.push_back (T);                                                                     // Setting temperature parameter...
+  parameter->data.push_back (Hx);                                                                    // Setting longitudinal magnetic field parameter...
+  parameter->data.push_back (Hz);                                                                    // Setting transverse magnetic field parameter...
+  parameter->data.push_back (m_max);                                                                 // Setting maximum allowed number of rejections parameter...
+  parameter->data.push_back ((float)nodes);                                                          // Setting number of nodes parameter...
+  parameter->data.push_back (ds);                                                                    // Setting simualtion spatial step parameter...
+  parameter->data.push_back (dt);                                                                    // Setting simulation time step parameter...
+  // Colour class (unused: baked in as SB_COLOUR, see thekernel_4.cl):
+  parameter->data.push_back (0.0f);                                                                  // Setting colour class parameter (unused)...
+  parameter->data.push_back ((float)depth);                                                          // Setting observable ring depth parameter...
+  parameter->data.push_back ((float)REDUCTION_ITEMS);                                                // Setting number of partial summations parameter...
+  parameter->data.push_back ((float)replicas);                                                       // Setting number of replicas parameter...
+  parameter->data.push_back ((float)steps);                                                          // Setting trial length parameter...
+  parameter->data.push_back ((float)rng_mode);                                                       // Setting random generator mode parameter...
+  parameter->data.push_back ((float)(seed & 0xFFFF));                                                // Setting random generator seed parameter (low half)...
+  parameter->data.push_back ((float)(seed >> 16));                                                   // Setting random generator seed parameter (high half)...
+  parameter->data.push_back (0.0f);                                                                  // Setting grid columns parameter (structured grid only)...
+  parameter->data.push_back (0.0f);                                                                  // Setting grid rows parameter (structured grid only)...
+  parameter->data.push_back (0.0f);                                                                  // Setting grid stencil parameter (0 = unstructured mesh)...
+  parameter->data.push_back ((float)sampler);                                                        // Setting single-site sampler parameter...
+  // CSR rows and first row node (owned range on multi-device runs, set per partition below):
+  parameter->data.push_back ((float)nodes);                                                          // Setting CSR rows parameter...
+  parameter->data.push_back (decay_sz);                                                              // Setting decay threshold parameter...
+  parameter->data.push_back (decay ? 1.0f : 0.0f);                                                   // Setting decay detection parameter...
+  parameter->data.push_back (long_mode ? 1.0f : 0.0f);                                               // Setting long-range field parameter...
+  parameter->data.push_back (0.0f);                                                                  // Setting first CSR row node parameter...
+  parameter->data.push_back (compact ? 1.0f : 0.0f);                                                 // Setting compact neighbour indices parameter...
+  parameter->data.push_back (0.0f);                                                                  // Setting boundary nodes parameter (multi-device runs)...
+  parameter->data.push_back (energy_mode ? 1.0f : 0.0f);                                             // Setting energy reduction parameter...
+
+  // SETTING COUPLING TABLE:
+  for(i = 0; i < nodes; i++)
+  {
+    node_x.push_back (position->data[i].x);                                                          // Getting node "x" coordinate...
+    node_y.push_back (position->data[i].y);                                                          // Getting node "y" coordinate...
+  }
+
+  // Coordinates stay on the host, the kernels still take the buffer (layout 0, read by the shader):
+  position->data.assign (1, {0.0f, 0.0f, 0.0f, 1.0f});                                               // Setting placeholder coordinates...
+
+  if(lattice_x > 0)
+  {
+    edge.swap (grid->length);                                                                        // Getting edge lengths (generated lattice)...
+  }
+  else
+  {
+    edge = sb::edge_length (
+                            node_x,
+                            node_y,
+                            neighbour->data,
+                            offset->data,
+                            sb::period (node_x, side_x_nodes),
+                            sb::period (node_y, side_y_nodes)
+                           );                                                                        // Computing edge lengths...
+  }
+
+  coupling->data = sb::coupling (edge, ds, alpha);                                                   // Computing coupling table...
+
+  // DETECTING STRUCTURED GRID (implicit stencil kernel K6 instead of K1 for the Jacobi update):
+  if(grid_mode &&
+     sb::structured_grid (
+                         node_x,
+                         node_y,
+                         neighbour->data,
+                         offset->data,
+                         edge,
+                         ds,
+                         grid_node->data,
+                         grid_columns,
+                         grid_rows,
+                         grid_stencil
+                        ))
+  {
+    parameter->data[16] = (float)grid_columns;                                                       // Setting grid columns parameter...
+    parameter->data[17] = (float)grid_rows;                                                          // Setting grid rows parameter...
+    parameter->data[18] = (float)grid_stencil;                                                       // Setting grid stencil parameter...
+    structured          = true;                                                                      // Setting structured grid flag...
+    std::cout << "structured grid: " << grid_columns << " x " << grid_rows << ", "
+              << grid_stencil << " neighbours." << std::endl;                                        // Printing message...
+  }
+  else
+  {
+    grid_node->data.assign (1, 0);                                                                   // Setting placeholder grid...
+    structured          = false;                                                                     // Setting structured grid flag...
+  }
+
+  // SETTING LONG-RANGE COUPLING (FFT convolution on the grid, CSR update kernels; placeholders otherwise):
+  if(long_mode)
+  {
+    if(!structured || !sb::power_of_two (grid_columns) || !sb::power_of_two (grid_rows))
+    {
+      std::cerr << "Error: long-range runs need a regular periodic grid with a power of two "
+                << "number of columns and rows." << std::endl;                                       // Printing message...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    spacing                 = edge[grid_node->data[grid_columns*grid_rows]]/ds;                      // Getting grid spacing (axial reference edge)...
+    spectrum->data.assign (2*nodes*replicas, 0.0f);                                                  // Resetting long-range field spectrum...
+    coupling_spectrum->data = sb::long_range_spectrum (grid_columns, grid_rows, spacing, alpha);     // Computing long-range coupling spectrum...
+    long_range->data.assign (nodes*replicas, 0.0f);                                                  // Resetting long-range field...
+    // The long-range field needs the CSR update kernels, the grid is kept for the FFT:
+    structured              = false;                                                                 // Using the CSR update kernels...
+    std::cout << "long-range coupling: " << grid_columns << " x " << grid_rows << " FFT."
+              << std::endl;                                                                          // Printing message...
+  }
+  else
+  {
+    spectrum->data.assign (1, 0.0f);                                                                 // Setting placeholder spectrum...
+    coupling_spectrum->data.assign (1, 0.0f);                                                        // Setting placeholder spectrum...
+    long_range->data.assign (1, 0.0f);                                                               // Setting placeholder field...
+  }
+
+
+  // SETTING GRAPH COLOURING:
+  colour_nodes   = sb::colour_classes (
+                                       sb::colour (neighbour->data, offset->data),
+                                       colour_node->data,
+                                       colour_offset->data
+                                      );                                                             // Colouring mesh graph...
+  colours        = colour_offset->data.size ();                                                      // Getting number of colours...
+  std::cout << "colours = " << colours << " (largest class = " << colour_nodes << " nodes)"
+            << std::endl;                                                                            // Printing message...
+
+  // PARTITIONING MESH (multi-device runs: this process updates a range of CSR rows):
+  domain->end = nodes;                                                                               // Owning all nodes (single partition)...
+  halo->data.assign (1, 0.0f);                                                                       // Setting placeholder halo values...
+  halo_node->data.assign (1, 0);                                                                     // Setting placeholder boundary nodes...
+
+  if(parts > 1)
+  {
+    domain->split (neighbour->data, offset->data, parts, part);                                      // Splitting mesh...
+    domain->slice (neighbour->data, offset->data, coupling->data);                                   // Keeping owned CSR rows (slice indices)...
+    halo->data.assign ((domain->boundary.size () + domain->ghost.size ())*replicas, 0.0f);           // Sizing halo values...
+    halo_node->data.resize (domain->boundary.size ());                                               // Sizing boundary nodes...
+
+    for(i = 0; i < domain->boundary.size (); i++)
+    {
+      halo_node->data[i] = domain->boundary[i] - (int)domain->begin;                                 // Setting boundary node (slice index)...
+    }
+
+    parameter->data[5]  = (float)domain->size ();                                                    // Setting theta slice size parameter...
+    parameter->data[20] = (float)domain->nodes ();                                                   // Setting CSR rows parameter...
+    parameter->data[24] = (float)domain->begin;                                                      // Setting first CSR row node parameter...
+    parameter->data[26] = (float)domain->boundary.size ();                                           // Setting boundary nodes parameter...
+    std::cout << "partition " << part << "/" << parts << ": nodes " << domain->begin << " to "
+              << domain->end - 1 << ", " << domain->boundary.size () << " boundary nodes, "
+              << domain->ghost.size () << " ghost nodes." << std::endl;                              // Printing message...
+
+    if(!exchange->open (halo_file, hash ^ seed, parts, part, nodes*replicas,
+                        observable->data.size ()))
+    {
+      std::cerr << "Error: cannot open halo file " << halo_file << "." << std::endl;                 // Printing message...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+  }
+
+  rows  = domain->nodes ();                                                                          // Setting number of CSR rows...
+  slice = domain->size ();                                                                           // Setting theta slice size...
+
+  // SETTING NEUTRINO ARRAYS ("replica" depending, one slice of "slice" items per replica):
+  theta_value.assign (slice*replicas, theta_start);                                                  // Setting initial theta...
+  theta_int_value.assign (slice*replicas, theta_start);                                              // Setting initial theta (intermediate value)...
+  m_overflow->data.assign (sb::packed_size (slice*replicas), 0);                                     // Resetting rejection sampling iterations...
+
+  // NARROWING NEIGHBOUR INDICES (compact storage: 16-bit offsets from the node, see compact.hpp):
+  if(compact)
+  {
+    if(!sb::narrow_neighbours (
+                               neighbour->data,
+                               offset->data,
+                               0,
+                               slice,
+                               neighbour->data
+                              ))
+    {
+      std::cerr << "Error: neighbour offsets exceed 16 bits, use reorder = rcm or compact = false."
+                << std::endl;                                                                        // Printing message...
+      exchange->abort ();                                                                            // Stopping the other partitions (multi-device runs)...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    std::cout << "compact neighbour indices: " << neighbour->data.size () << " words for "
+              << coupling->data.size () << " entries." << std::endl;                                 // Printing message...
+  }
+
+  // UPLOADING INITIAL THETA:
+  if(sb::is_snapshot (upload_file))
+  {
+    if(!snapshot_in->open (upload_file) || (snapshot_in->records () == 0))
+    {
+      std::cerr << "Error: cannot read " << upload_file << "." << std::endl;                         // Printing message...
+      exchange->abort ();                                                                            // Stopping the other partitions (multi-device runs)...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    if((snapshot_in->nodes () != nodes) || (snapshot_in->mesh_hash () != hash))
+    {
+      std::cerr << "Error: " << upload_file << " does not match the mesh." << std::endl;             // Printing message...
+      exchange->abort ();                                                                            // Stopping the other partitions (multi-device runs)...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    upload_theta.assign (
+                         snapshot_in->theta (snapshot_in->records () - 1),
+                         snapshot_in->theta (snapshot_in->records () - 1) + nodes
+                        );                                                                           // Getting last snapshot field...
+    snapshot_in->close ();                                                                           // Closing snapshot file...
+    sb::permute (order, upload_theta);                                                               // Mapping theta to the node order...
+
+    // Setting theta for all nodes of all replicas:
+    for(i = 0; i < slice*replicas; i++)
+    {
+      theta_value[i]     = upload_theta[domain->node (i%slice)];                                     // Setting initial theta...
+      theta_int_value[i] = upload_theta[domain->node (i%slice)];                                     // Setting initial theta (intermediate value)...
+    }
+  }
+  else if(!upload_file.empty ())
+  {
+    upload_theta.clear ();
+
+    upload->open (upload_file, ULOAD_EXT, ULOAD_HEAD, "\t", nu::READ);                               // Opening data upload file...
+
+    while(!upload->eof ())
+    {
+      upload->read (&upload_i, &upload_x, &upload_y, &upload_theta);
+    }
+
+    upload->close (nu::READ);
+
+    if(upload_theta.size () != nodes)
+    {
+      std::cerr << "Error: " << upload_file << " does not match the mesh." << std::endl;             // Printing message...
+      exchange->abort ();                                                                            // Stopping the other partitions (multi-device runs)...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    sb::permute (order, upload_theta);                                                               // Mapping theta to the node order...
+
+    // Setting theta for all nodes of all replicas:
+    for(i = 0; i < slice*replicas; i++)
+    {
+      theta_value[i]     = upload_theta[domain->node (i%slice)];                                     // Setting initial theta...
+      theta_int_value[i] = upload_theta[domain->node (i%slice)];                                     // Setting initial theta (intermediate value)...
+    }
+  }
+
+  // RESTARTING FROM CHECKPOINT:
+  if(!restart_file.empty ())
+  {
+    if(!ckpt->load (restart_file))
+    {
+      std::cerr << "Error: cannot read " << restart_file << "." << std::endl;                        // Printing message...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    ckpt->get ("hash", &ckpt_value, sizeof (ckpt_value));                                            // Getting mesh hash...
+
+    if(ckpt_value != hash)
+    {
+      std::cerr << "Error: " << restart_file << " does not match the mesh." << std::endl;            // Printing message...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    ckpt_order.resize (nodes);                                                                       // Sizing checkpoint node order...
+    ckpt->get ("order", ckpt_order.data (), nodes*sizeof (int));                                     // Getting node order...
+
+    if(ckpt_order != order)
+    {
+      std::cerr << "Error: " << restart_file << " does not match the node reordering." << std::endl; // Printing message...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    ckpt->get ("parameter", parameter->data.data (), parameter->data.size ()*sizeof (float));        // Getting parameters...
+
+    if((int)parameter->data[19] != sampler)
+    {
+      std::cerr << "Error: " << restart_file << " does not match the sampler." << std::endl;         // Printing message...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    if((parameter->data[22] != 0.0f) != decay)
+    {
+      std::cerr << "Error: " << restart_file << " does not match the decay detection." << std::endl; // Printing message...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    if((parameter->data[27] != 0.0f) != energy_mode)
+    {
+      std::cerr << "Error: " << restart_file << " does not match the energy reduction."
+                << std::endl;                                                                        // Printing message...
+      exit (EXIT_FAILURE);                                                                           // Exiting...
+    }
+
+    ckpt->get ("temperature", temperature->data.data (), replicas*sizeof (float));                   // Getting replica temperatures...
+    ckpt->get ("replica", replica->data.data (), replicas*sizeof (replica->data[0]));                // Getting replica states...
+    ckpt->get ("theta", theta_value.data (), nodes*replicas*sizeof (float));                         // Getting theta...
+    ckpt->get ("theta_int", theta_int_value.data (), nodes*replicas*sizeof (float));                 // Getting theta (intermediate value)...
+    ckpt->get ("state_theta", state_theta->data.data (),
+               state_theta->data.size ()*sizeof (state_theta->data[0]));                             // Getting random generator state...
+    ckpt->get ("state_threshold", state_threshold->data.data (),
+               state_threshold->data.size ()*sizeof (state_threshold->data[0]));                     // Getting random generator state...
+    ckpt->get ("m_overflow", m_overflow->data.data (),
+               m_overflow->data.size ()*sizeof (int));                                               // Getting rejection sampling iterations...
+    ckpt->get ("step", step->data.data (), sizeof (int));                                            // Getting step counter...
+    ckpt->get ("trial_index", &trial_index, sizeof (trial_index));                                   // Getting trial index...
+    ckpt->get ("step_index", &step_index, sizeof (step_index));                                      // Getting step index...
+    ckpt->get ("running", &running, sizeof (running));                                               // Getting number of running replicas...
+    ckpt_trial = trial_index;                                                                        // Setting trial index at last checkpoint...
+
+    if(ckpt->has ("statistics"))
+    {
+      stat_state.resize (replicas*stat[0].state ().size ());                                         // Sizing statistics state...
+      ckpt->get ("statistics", stat_state.data (), stat_state.size ()*sizeof (double));              // Getting statistics state...
+
+      for(q = 0; q < replicas; q++)
+      {
+        k = stat_state.size ()/replicas;                                                             // Getting replica statistics size...
+        stat[q].restore (std::vector<double> (stat_state.begin () + q*k,
+                                              stat_state.begin () + (q + 1)*k));                     // Restoring replica statistics...
+      }
+    }
+
+    if(tempering)
+    {
+      ladder_state.resize (ckpt->size ("tempering"));                                                // Allocating temperature ladder state...
+      ckpt->get ("tempering", &ladder_state[0], ladder_state.size ());                               // Getting temperature ladder state...
+      ladder->restore (ladder_state);                                                                // Restoring temperature ladder...
+    }
+
+    std::cout << "restarting from " << restart_file << " (step " << step_index << ", "
+              << trial_index << " trials started)." << std::endl;                                    // Printing message...
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////// OPENCL KERNELS INITIALIZATION /////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  // SPECIALISING KERNELS (run constants as JIT build options, node counts exact):
+  if(!specialise && (nodes > SPECIALISE_EXACT))
+  {
+    std::cerr << "Error: meshes of more than 2^24 nodes need specialise = true (the parameter "
+              << "array holds floats)." << std::endl;                                                // Printing message...
+    exchange->abort ();                                                                              // Stopping the other partitions (multi-device runs)...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  if(specialise)
+  {
+    options = sb::kernel_options (
+                                  parameter->data,
+                                  {
+                                   {5, slice}, {20, rows}, {24, domain->begin},
+                                   {26, domain->boundary.size ()}
+                                  },
+                                  {}
+                                 );                                                                  // Getting build options...
+    std::cout << "kernel options: " << options << std::endl;                                         // Printing message...
+    K0->compiler_options = options;                                                                  // Setting JIT build options...
+    K1->compiler_options = options;                                                                  // Setting JIT build options...
+    K2->compiler_options = options;                                                                  // Setting JIT build options...
+    K3->compiler_options = options;                                                                  // Setting JIT build options...
+    K5->compiler_options = options;                                                                  // Setting JIT build options...
+    K6->compiler_options = options;                                                                  // Setting JIT build options...
+    K7->compiler_options = options;                                                                  // Setting JIT build options...
+    K8->compiler_options = options;                                                                  // Setting JIT build options...
+    K9->compiler_options = options;                                                                  // Setting JIT build options...
+    K10->compiler_options = options;                                                                 // Setting JIT build options...
+    K11->compiler_options = options;                                                                 // Setting JIT build options...
+  }
+
+  K0->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                               // Setting kernel source file...
+  K0->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                   // Setting kernel source file...
+  K0->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_0));                                // Setting kernel source file...
+  K0->build (rows, replicas, 0);                                                                     // Building kernel program...
+  K1->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                               // Setting kernel source file...
+  K1->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                   // Setting kernel source file...
+  K1->addsource (std::string (KERNEL_HOME) + std::string (HEATBATH));                                // Setting kernel source file...
+  K1->addsource (std::string (KERNEL_HOME) + std::string (METROPOLIS));                              // Setting kernel source file...
+  K1->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_1));                                // Setting kernel source file...
+  K1->build (rows, replicas, 0);                                                                     // Building kernel program...
+  K2->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                               // Setting kernel source file...
+  K2->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                   // Setting kernel source file...
+  K2->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_2));                                // Setting kernel source file...
+  K2->build (rows, replicas, 0);                                                                     // Building kernel program...
+  K3->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                               // Setting kernel source file...
+  K3->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                   // Setting kernel source file...
+  K3->addsource (std::string (KERNEL_HOME) + std::string (HEATBATH));                                // Setting kernel source file...
+  K3->addsource (std::string (KERNEL_HOME) + std::string (METROPOLIS));                              // Setting kernel source file...
+  K3->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_3));                                // Setting kernel source file...
+  K3->build (REDUCTION_ITEMS, replicas, 0);                                                          // Building kernel program...
+  K5->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                               // Setting kernel source file...
+  K5->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                   // Setting kernel source file...
+  K5->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_5));                                // Setting kernel source file...
+  K5->build (replicas, 0, 0);                                                                        // Building kernel program...
+
+  if(colour_mode)
+  {
+    for(c = 0; c < colours; c++)
+    {
+      K4.push_back (new nu::kernel ());                                                              // Adding colour phase kernel...
+      K4[c]->compiler_options = options + " -D SB_COLOUR=" + std::to_string (c) + "u";               // Setting JIT build options (colour class)...
+      K4[c]->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                        // Setting kernel source file...
+      K4[c]->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                            // Setting kernel source file...
+      K4[c]->addsource (std::string (KERNEL_HOME) + std::string (HEATBATH));                         // Setting kernel source file...
+      K4[c]->addsource (std::string (KERNEL_HOME) + std::string (METROPOLIS));                       // Setting kernel source file...
+      K4[c]->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_4));                         // Setting kernel source file...
+      K4[c]->build (
+                  colour_offset->data[c] - ((c == 0) ? 0 : colour_offset->data[c - 1]),
+                  replicas,
+                  0
+                 );                                                                                  // Building kernel program (colour class size)...
+    }
+  }
+
+  if(structured)
+  {
+    K6->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                             // Setting kernel source file...
+    K6->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                 // Setting kernel source file...
+    K6->addsource (std::string (KERNEL_HOME) + std::string (HEATBATH));                              // Setting kernel source file...
+    K6->addsource (std::string (KERNEL_HOME) + std::string (METROPOLIS));                            // Setting kernel source file...
+    K6->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_6));                              // Setting kernel source file...
+    K6->build (
+               (grid_columns + GRID_TILE - 1)/GRID_TILE*GRID_TILE,
+               (grid_rows + GRID_TILE - 1)/GRID_TILE*GRID_TILE,
+               replicas
+              );                                                                                     // Building kernel program (whole 16 x 16 work-groups)...
+  }
+
+  if(long_mode)
+  {
+    K7->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                             // Setting kernel source file...
+    K7->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                 // Setting kernel source file...
+    K7->addsource (std::string (KERNEL_HOME) + std::string (FFT));                                   // Setting kernel source file...
+    K7->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_7));                              // Setting kernel source file...
+    K7->build (grid_rows, replicas, 0);                                                              // Building kernel program...
+    K8->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                             // Setting kernel source file...
+    K8->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                 // Setting kernel source file...
+    K8->addsource (std::string (KERNEL_HOME) + std::string (FFT));                                   // Setting kernel source file...
+    K8->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_8));                              // Setting kernel source file...
+    K8->build (grid_columns, replicas, 0);                                                           // Building kernel program...
+    K9->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                             // Setting kernel source file...
+    K9->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                 // Setting kernel source file...
+    K9->addsource (std::string (KERNEL_HOME) + std::string (FFT));                                   // Setting kernel source file...
+    K9->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_9));                              // Setting kernel source file...
+    K9->build (grid_rows, replicas, 0);                                                              // Building kernel program...
+  }
+
+  if(parts > 1)
+  {
+    K10->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                            // Setting kernel source file...
+    K10->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                // Setting kernel source file...
+    K10->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_10));                            // Setting kernel source file...
+    K10->build (domain->boundary.size (), replicas, 0);                                              // Building kernel program...
+    K11->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                            // Setting kernel source file...
+    K11->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                // Setting kernel source file...
+    K11->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_11));                            // Setting kernel source file...
+    K11->build (domain->ghost.size (), replicas, 0);                                                 // Building kernel program...
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////// SETTING OPENCL KERNEL ARGUMENTS /////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  sb::pack_angles (theta_value, theta->data);                                                        // Packing theta...
+  sb::pack_angles (theta_int_value, theta_int->data);                                                // Packing theta (intermediate value)...
+  cl->write ();                                                                                      // Writing OpenCL data...
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  /////////////////////////////////////// OPENING DATA LOG FILE //////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  timestamp   = cl->get_timestamp ();                                                                // Getting timestamp...
+  time_index  = 0;                                                                                   // Resetting time index...
+  if(parts > 1)
+  {
+    timestamp += "_" + std::to_string (part);                                                        // Adding partition index to output file names...
+  }
+
+  if(jobs > 1)
+  {
+    timestamp += "_" + std::to_string (job);                                                         // Adding sweep job index to output file names...
+  }
+
+  log->open (output + LOG_FILE + timestamp, LOG_EXT, LOG_HEAD, "\t", nu::WRITE);                     // Opening data log file...
+  log->write ("#time");                                                                              // Logging header...
+  log->write ("#sz_avg");                                                                            // Logging header...
+  log->write ("#sz_stderr");                                                                         // Logging header...
+  log->write ("#m_level");                                                                           // Logging header...
+  log->write ("#trial");                                                                             // Logging header...
+  log->write ("#replica");                                                                           // Logging header...
+  log->write ("#T");                                                                                 // Logging header...
+
+  if(energy_mode)
+  {
+    log->write ("#energy");                                                                          // Logging header...
+  }
+
+  log->endline ();                                                                                   // Logging header...
+
+  stat_log->open (output + STAT_FILE + timestamp, LOG_EXT, LOG_HEAD, "\t", nu::WRITE);               // Opening statistics log file...
+  stat_log->write ("#trial");                                                                        // Logging header...
+  stat_log->write ("#replica");                                                                      // Logging header...
+  stat_log->write ("#T");                                                                            // Logging header...
+  stat_log->write ("#steps");                                                                        // Logging header...
+  stat_log->write ("#sz_avg");                                                                       // Logging header...
+  stat_log->write ("#sz_stderr");                                                                    // Logging header...
+  stat_log->write ("#sz_naive");                                                                     // Logging header...
+  stat_log->write ("#tau");                                                                          // Logging header...
+  stat_log->write ("#samples_eff");                                                                  // Logging header...
+  stat_log->endline ();                                                                              // Logging header...
+
+  if(decay)
+  {
+    decay_log->open (output + DECAY_FILE + timestamp, LOG_EXT, LOG_HEAD, "\t", nu::WRITE);           // Opening decay log file...
+    decay_log->write ("#trial");                                                                     // Logging header...
+    decay_log->write ("#replica");                                                                   // Logging header...
+    decay_log->write ("#T");                                                                         // Logging header...
+    decay_log->write ("#step");                                                                      // Logging header...
+    decay_log->write ("#decayed");                                                                   // Logging header...
+    decay_log->endline ();                                                                           // Logging header...
+  }
+
+  if(profile && !prof->open (output + PROFILE_FILE + timestamp + "." + PROFILE_EXT))
+  {
+    std::cerr << "Error: cannot create timing log in " << output << std::endl;                       // Printing message...
+    exchange->abort ();                                                                              // Stopping the other partitions (multi-device runs)...
+    exit (EXIT_FAILURE);                                                                             // Exiting...
+  }
+
+  // Launching every kernel blocking when profiling, so that each one is timed on its own channel:
+  launch      = profile ? nu::WAIT : nu::DONT_WAIT;                                                  // Setting kernel launch mode...
+
+  // ESTIMATING DEVICE MEMORY TRAFFIC PER SWEEP (CSR path, each access counted once):
+  // update + copy + reduction: 30 bytes per node (offsets, 16-bit theta, theta_int, iterations), 22
+  // bytes without the energy reduction (no offsets in the reduction), update (and energy reduction):
+  // 10 bytes per CSR entry (neighbour, coupling, 16-bit neighbour theta), 8 bytes with compact
+  // neighbour indices, xoshiro states 64 bytes per node.
+  traffic     = (double)replicas*(rows*((energy_mode ? 30.0 : 22.0) +
+                                        ((rng_mode == RNG_XOSHIRO) ? 64.0 : 0.0)) +
+                                  coupling->data.size ()*(compact ? 8.0 : 10.0)*
+                                  (energy_mode ? 2.0 : 1.0));                                        // Estimating traffic...
+  prof->add ("bytes/sweep", traffic);                                                                // Adding sample...
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////// CHARGING RANDOM GENERATORS ////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  if(restart_file.empty () && (rng_mode == RNG_XOSHIRO))
+  {
+    // Xoshiro states only, a restart restores them and Philox is stateless:
+    prof->begin ("K0");                                                                              // Starting kernel timer...
+    cl->execute (K0, nu::WAIT);                                                                      // Executing OpenCL kernel...
+    prof->end ("K0");                                                                                // Stopping kernel timer...
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  /////////////////////////////////////////// BATCH LOOP /////////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  while(running > 0)
+  {
+    prof->begin ("readback");                                                                        // Starting readback timer...
+    prof->begin ("batch");                                                                           // Starting batch timer...
+
+    // COMPUTING LONG-RANGE FIELD (theta written by the host at startup or at the last readback):
+    if(long_mode)
+    {
+      prof->begin ("K7");                                                                            // Starting kernel timer...
+      cl->execute (K7, launch);                                                                      // Executing OpenCL kernel (row transforms)...
+      prof->end ("K7");                                                                              // Stopping kernel timer...
+      prof->begin ("K8");                                                                            // Starting kernel timer...
+      cl->execute (K8, launch);                                                                      // Executing OpenCL kernel (column convolution)...
+      prof->end ("K8");                                                                              // Stopping kernel timer...
+      prof->begin ("K9");                                                                            // Starting kernel timer...
+      cl->execute (K9, launch);                                                                      // Executing OpenCL kernel (inverse row transforms)...
+      prof->end ("K9");                                                                              // Stopping kernel timer...
+    }
+
+    for(time_index = 0; time_index < depth; time_index++)
+    {
+      if(colour_mode)
+      {
+        for(c = 0; c < colours; c++)
+        {
+          prof->begin ("K4");                                                                        // Starting kernel timer...
+          cl->execute (K4[c], launch);                                                               // Executing OpenCL kernel (colour class baked in)...
+          prof->end ("K4");                                                                          // Stopping kernel timer...
+
+          // COMPUTING LONG-RANGE FIELD (refreshed at every colour phase):
+          if(long_mode)
+          {
+            prof->begin ("K7");                                                                      // Starting kernel timer...
+            cl->execute (K7, launch);                                                                // Executing OpenCL kernel (row transforms)...
+            prof->end ("K7");                                                                        // Stopping kernel timer...
+            prof->begin ("K8");                                                                      // Starting kernel timer...
+            cl->execute (K8, launch);                                                                // Executing OpenCL kernel (column convolution)...
+            prof->end ("K8");                                                                        // Stopping kernel timer...
+            prof->begin ("K9");                                                                      // Starting kernel timer...
+            cl->execute (K9, launch);                                                                // Executing OpenCL kernel (inverse row transforms)...
+            prof->end ("K9");                                                                        // Stopping kernel timer...
+          }
+        }
+      }
+      else
+      {
+        prof->begin (structured ? "K6" : "K1");                                                      // Starting kernel timer...
+        cl->execute (structured ? K6 : K1, launch);                                                  // Executing OpenCL kernel (K6 on structured grids)...
+        prof->end (structured ? "K6" : "K1");                                                        // Stopping kernel timer...
+        prof->begin ("K2");                                                                          // Starting kernel timer...
+        cl->execute (K2, launch);                                                                    // Executing OpenCL kernel...
+        prof->end ("K2");                                                                            // Stopping kernel timer...
+
+        // COMPUTING LONG-RANGE FIELD (refreshed at every sweep, used by K3 and the next sweep):
+        if(long_mode)
+        {
+          prof->begin ("K7");                                                                        // Starting kernel timer...
+          cl->execute (K7, launch);                                                                  // Executing OpenCL kernel (row transforms)...
+          prof->end ("K7");                                                                          // Stopping kernel timer...
+          prof->begin ("K8");                                                                        // Starting kernel timer...
+          cl->execute (K8, launch);                                                                  // Executing OpenCL kernel (column convolution)...
+          prof->end ("K8");                                                                          // Stopping kernel timer...
+          prof->begin ("K9");                                                                        // Starting kernel timer...
+          cl->execute (K9, launch);                                                                  // Executing OpenCL kernel (inverse row transforms)...
+          prof->end ("K9");                                                                          // Stopping kernel timer...
+        }
+
+        // EXCHANGING GHOST THETA (multi-device runs):
+        if(parts > 1)
+        {
+          prof->begin ("K10");                                                                       // Starting kernel timer...
+          cl->execute (K10, launch);                                                                 // Executing OpenCL kernel (packing boundary theta)...
+          prof->end ("K10");                                                                         // Stopping kernel timer...
+          prof->begin ("halo read");                                                                 // Starting transfer timer...
+          cl->read (24);                                                                             // Reading halo values (waits for the sweep)...
+          prof->end ("halo read");                                                                   // Stopping transfer timer...
+          prof->begin ("halo");                                                                      // Starting halo timer (host exchange)...
+          exchange->exchange (halo->data.data (), nodes, domain->boundary, domain->ghost);           // Exchanging halo...
+          prof->end ("halo");                                                                        // Stopping halo timer...
+          prof->begin ("halo write");                                                                // Starting transfer timer...
+          cl->write (24);                                                                            // Updating halo values...
+          prof->end ("halo write");                                                                  // Stopping transfer timer...
+          prof->begin ("K11");                                                                       // Starting kernel timer...
+          cl->execute (K11, launch);                                                                 // Executing OpenCL kernel (unpacking ghost theta)...
+          prof->end ("K11");                                                                         // Stopping kernel timer...
+        }
+      }
+
+      prof->begin ("K3");                                                                            // Starting kernel timer...
+      cl->execute (K3, launch);                                                                      // Executing OpenCL kernel...
+      prof->end ("K3");                                                                              // Stopping kernel timer...
+      prof->begin ("K5");                                                                            // Starting kernel timer...
+      cl->execute (K5, launch);                                                                      // Executing OpenCL kernel...
+      prof->end ("K5");                                                                              // Stopping kernel timer...
+    }
+
+    prof->end ("batch");                                                                             // Stopping batch timer...
+    prof->add ("sweep", prof->last ("batch")/depth);                                                 // Adding sample (batch time per sweep)...
+
+    if(first_batch)
+    {
+      prof->add ("first batch", prof->uptime ());                                                    // Adding time to first batch [us]...
+      first_batch = false;                                                                           // Resetting first batch flag...
+    }
+
+    // READING OBSERVABLES (every "depth" steps):
+    prof->begin ("read");                                                                            // Starting transfer timer...
+    cl->read (15);                                                                                   // Reading observables...
+    cl->read (17);                                                                                   // Reading replica states...
+    prof->end ("read");                                                                              // Stopping transfer timer...
+
+    // SUMMING OBSERVABLES OVER ALL PARTITIONS (multi-device runs, replica steps are the same everywhere):
+    if(parts > 1)
+    {
+      observable_part = observable->data;                                                            // Getting partition observables...
+      exchange->reduce (observable->data.data ());                                                   // Summing observables...
+
+      for(k = OBS_STEP; k < observable->data.size (); k += OBSERVABLES)
+      {
+        observable->data[k] = observable_part[k];                                                    // Keeping replica step...
+      }
+    }
+
+    prof->begin ("log");                                                                             // Starting log timer...
+
+    for(j = 0; j < depth; j++)
+    {
+      slot = (step_index + j) % depth;                                                               // Getting observable ring slot...
+
+      for(q = 0; q < replicas; q++)
+      {
+        k = (slot*replicas + q)*OBSERVABLES;                                                         // Getting observable base index...
+
+        // Skipping replicas not running a trial at this step:
+        if(observable->data[k + OBS_STEP] == 0.0f)
+        {
+          continue;
+        }
+
+        spin_z_avg    = observable->data[k + OBS_SZ]/nodes;                                          // Computing spin_z average...
+        spin_z_stderr = observable->data[k + OBS_SZ2];                                               // Getting z-spin square summation...
+        spin_z_stderr = (float)sqrt (spin_z_stderr/nodes - pow (spin_z_avg, 2))/(float)sqrt (nodes); // Computing spin_z standard deviation...
+        m_level       = 100.0f*(observable->data[k + OBS_OVERFLOW]/nodes);                           // Computing rejection sampling overflow level...
+
+        log->write ((unsigned int)observable->data[k + OBS_STEP] - 1);                               // Logging data...
+        log->write (spin_z_avg);                                                                     // Logging data...
+        log->write (spin_z_stderr);                                                                  // Logging data...
+        log->write (m_level);                                                                        // Logging data...
+        log->write ((unsigned int)replica->data[q].y);                                               // Logging data...
+        log->write ((unsigned int)q);                                                                // Logging data...
+        log->write (temperature->data[q]);                                                           // Logging data...
+
+        if(energy_mode)
+        {
+          log->write (observable->data[k + OBS_ENERGY]/nodes);                                       // Logging data (energy per node)...
+        }
+
+        log->endline ();                                                                             // Ending log line...
+
+        // Accumulating statistics (after the burn-in):
+        if(((size_t)observable->data[k + OBS_STEP] - 1) >= burn)
+        {
+          stat[q].add (spin_z_avg);                                                                  // Adding <sz> sample...
+        }
+
+        if(sweeping)
+        {
+          plan->add (
+                     plan->point (replica->data[q].y),
+                     (size_t)observable->data[k + OBS_STEP] - 1,
+                     spin_z_avg,
+                     observable->data[k + OBS_ENERGY]/nodes
+                    );                                                                               // Accumulating sweep point observables...
+        }
+      }
+    }
+
+    prof->end ("log");                                                                               // Stopping log timer...
+    prof->end ("readback");                                                                          // Stopping readback timer...
+
+    // PROFILING (rates of the last readback, iterations of all running replica steps of the ring):
+    if(profile)
+    {
+      sweeps = depth*1.0e6/prof->last ("readback");                                                  // Computing sweeps per second...
+      prof->add ("sweeps/s", sweeps);                                                                // Adding sample...
+      prof->add ("updates/s", sweeps*rows*running);                                                  // Adding sample...
+
+      iterations = 0.0;                                                                              // Resetting iterations summation...
+      counted    = 0;                                                                                // Resetting replica steps...
+
+      for(k = 0; k < observable->data.size (); k += OBSERVABLES)
+      {
+        if(observable->data[k + OBS_STEP] != 0.0f)
+        {
+          iterations += observable->data[k + OBS_ITERATIONS];                                        // Summing iterations (all nodes)...
+          counted++;                                                                                 // Counting replica step...
+        }
+      }
+
+      prof->add ("iterations/node", (counted > 0) ? iterations/(nodes*counted) : 0.0);               // Adding sample...
+      prof->write (step_index + depth);                                                              // Writing timing log...
+    }
+
+    step_index += depth;                                                                             // Updating step index...
+
+    // ENDING CONVERGED TRIALS (standard error of <sz> within the target, before the trial length):
+    if(target_error > 0.0f)
+    {
+      for(q = 0; q < replicas; q++)
+      {
+        if((replica->data[q].z == REPLICA_RUNNING) && stat[q].converged (target_error))
+        {
+          replica->data[q].z = REPLICA_DONE;                                                         // Ending trial...
+        }
+      }
+    }
+
+    // Counting finished replicas:
+    done = 0;                                                                                        // Resetting number of finished replicas...
+
+    for(q = 0; q < replicas; q++)
+    {
+      if(replica->data[q].z == REPLICA_DONE)
+      {
+        done++;                                                                                      // Updating number of finished replicas...
+      }
+    }
+
+    // ATTEMPTING REPLICA EXCHANGE (energies of the last step, all replicas running):
+    if(tempering && (done == 0))
+    {
+      slot = (step_index - 1) % depth;                                                               // Getting last observable ring slot...
+      energy.resize (replicas);                                                                      // Resizing replica energies...
+
+      for(q = 0; q < replicas; q++)
+      {
+        energy[q] = observable->data[(slot*replicas + q)*OBSERVABLES + OBS_ENERGY];                  // Getting replica energy...
+      }
+
+      ladder->swap (energy, temperature->data);                                                      // Swapping neighbour temperatures...
+      prof->begin ("write");                                                                         // Starting transfer timer...
+      cl->write (19);                                                                                // Updating replica temperatures...
+      prof->end ("write");                                                                           // Stopping transfer timer...
+    }
+
+    if(done > 0)
+    {
+      // Downloading data (whole owned theta published to partition 0 on multi-device runs):
+      prof->begin ("download");                                                                      // Starting transfer timer...
+      cl->read (3);                                                                                  // Reading theta...
+      prof->end ("download");                                                                        // Stopping transfer timer...
+      sb::unpack_angles (theta->data, theta_value);                                                  // Expanding theta...
+
+      if(parts > 1)
+      {
+        exchange->publish (theta_value.data (), slice, nodes, domain->begin, domain->end);           // Publishing owned theta...
+      }
+
+      if(rng_mode == RNG_XOSHIRO)
+      {
+        prof->begin ("download");                                                                    // Starting transfer timer...
+        cl->read (5);                                                                                // Reading random generator state...
+        cl->read (6);                                                                                // Reading random generator state...
+        prof->end ("download");                                                                      // Stopping transfer timer...
+      }
+
+      prof->begin ("snapshot");                                                                      // Starting snapshot timer...
+
+      if((part == 0) && !snapshot->is_open ())
+      {
+        snapshot->open (
+                        output + DLOAD_FILE + timestamp + "." + SNAPSHOT_EXT,
+                        hash,
+                        node_index,
+                        export_x,
+                        export_y,
+                        rng_mode == RNG_XOSHIRO
+                       );                                                                            // Opening download snapshot file...
+      }
+
+      for(q = 0; q < replicas; q++)
+      {
+        if(replica->data[q].z != REPLICA_DONE)
+        {
+          continue;
+        }
+
+        snapshot_parameter    = parameter->data;                                                     // Getting parameters...
+        snapshot_parameter[1] = temperature->data[q];                                                // Setting replica temperature...
+        snapshot_parameter[5] = (float)nodes;                                                        // Setting number of nodes (all partitions)...
+
+        // Writing snapshot (first partition only, from the global theta on multi-device runs):
+        if(part == 0)
+        {
+          field = (parts > 1) ? exchange->global () : theta_value.data ();                           // Getting theta of all nodes...
+          export_theta.resize (nodes);                                                               // Sizing download theta...
+
+          for(i = 0; i < nodes; i++)
+          {
+            export_theta[order[i]] = field[q*nodes + i];                                             // Mapping theta back to the mesh order...
+          }
+
+          if(rng_mode == RNG_XOSHIRO)
+          {
+            export_state_theta.resize (4*nodes);                                                     // Sizing download random generator state...
+            export_state_threshold.resize (4*nodes);                                                 // Sizing download random generator state...
+
+            for(i = 0; i < nodes; i++)
+            {
+              export_state_theta[4*order[i] + 0]     = state_theta->data[q*nodes + i].x;             // Mapping state back to the mesh order...
+              export_state_theta[4*order[i] + 1]     = state_theta->data[q*nodes + i].y;             // Mapping state back to the mesh order...
+              export_state_theta[4*order[i] + 2]     = state_theta->data[q*nodes + i].z;             // Mapping state back to the mesh order...
+              export_state_theta[4*order[i] + 3]     = state_theta->data[q*nodes + i].w;             // Mapping state back to the mesh order...
+              export_state_threshold[4*order[i] + 0] = state_threshold->data[q*nodes + i].x;         // Mapping state back to the mesh order...
+              export_state_threshold[4*order[i] + 1] = state_threshold->data[q*nodes + i].y;         // Mapping state back to the mesh order...
+              export_state_threshold[4*order[i] + 2] = state_threshold->data[q*nodes + i].z;         // Mapping state back to the mesh order...
+              export_state_threshold[4*order[i] + 3] = state_threshold->data[q*nodes + i].w;         // Mapping state back to the mesh order...
+            }
+          }
+
+          snapshot->write (
+                           step_index,
+                           replica->data[q].y,
+                           q,
+                           snapshot_parameter,
+                           export_theta.data (),
+                           (rng_mode == RNG_XOSHIRO) ? export_state_theta.data () : nullptr,
+                           (rng_mode == RNG_XOSHIRO) ? export_state_threshold.data () : nullptr
+                          );                                                                         // Writing download snapshot...
+        }
+
+        std::cout << "trial " << replica->data[q].y + 1 << "/" << trials << " done (<sz> = "
+                  << stat[q].mean () << " +/- " << stat[q].error () << ", tau = " << stat[q].tau ()
+                  << " steps)";                                                                      // Printing message...
+
+        // Recording trial statistics:
+        stat_log->write ((unsigned int)replica->data[q].y);                                          // Logging trial...
+        stat_log->write ((unsigned int)q);                                                           // Logging replica...
+        stat_log->write (temperature->data[q]);                                                      // Logging replica temperature...
+        stat_log->write ((unsigned int)replica->data[q].x);                                          // Logging trial steps...
+        stat_log->write ((float)stat[q].mean ());                                                    // Logging average z-spin...
+        stat_log->write ((float)stat[q].error ());                                                   // Logging average z-spin standard error...
+        stat_log->write ((float)stat[q].naive_error ());                                             // Logging average z-spin naive standard error...
+        stat_log->write ((float)stat[q].tau ());                                                     // Logging integrated autocorrelation time...
+        stat_log->write ((float)stat[q].effective_samples ());                                       // Logging effective samples...
+        stat_log->endline ();                                                                        // Ending log line...
+        stat[q].clear ();                                                                            // Resetting replica statistics...
+
+        // Recording decay time (trial step of the threshold crossing, or trial length if metastable):
+        if(decay)
+        {
+          decay_log->write ((unsigned int)replica->data[q].y);                                       // Logging trial...
+          decay_log->write ((unsigned int)q);                                                        // Logging replica...
+          decay_log->write (temperature->data[q]);                                                   // Logging replica temperature...
+          decay_log->write ((unsigned int)replica->data[q].x);                                       // Logging decay step...
+          decay_log->write ((unsigned int)(replica->data[q].w == DECAY_EVENT));                      // Logging decay flag...
+          decay_log->endline ();                                                                     // Ending log line...
+
+          if(replica->data[q].w == DECAY_EVENT)
+          {
+            std::cout << " (decayed at step " << replica->data[q].x << ")";                          // Printing message...
+          }
+        }
+
+        std::cout << "." << std::endl;                                                               // Printing message...
+
+        // Recording sweep point result (last theta kept to warm-start the same temperature in the next batch):
+        if(sweeping)
+        {
+          point = plan->point (replica->data[q].y);                                                  // Getting sweep point...
+          plan->finish (point, replica->data[q].w == DECAY_EVENT);                                   // Counting finished trial...
+          warm_next[plan->rung (point)].assign (
+                                                theta_value.begin () + q*nodes,
+                                                theta_value.begin () + (q + 1)*nodes
+                                               );                                                    // Keeping last theta...
+        }
+
+        if(trial_index < trial_limit)
+        {
+          start = &upload_theta;                                                                     // Setting initial theta...
+
+          if(sweeping)
+          {
+            point                = plan->point (trial_index);                                        // Getting sweep point...
+            temperature->data[q] = plan->T (point);                                                  // Setting sweep point temperature...
+
+            if(warm && !warm_theta[plan->rung (point)].empty ())
+            {
+              start = &warm_theta[plan->rung (point)];                                               // Setting warm-start theta...
+            }
+          }
+
+          // Resetting theta for all nodes of the replica:
+          for(i = 0; i < slice; i++)
+          {
+            theta_value[q*slice + i] = (*start)[domain->node (i)];                                   // Setting initial theta...
+          }
+
+          replica->data[q] = {0, (int)trial_index, REPLICA_RUNNING, 0};                              // Assigning next trial to replica...
+          trial_index++;                                                                             // Updating trial index...
+        }
+        else
+        {
+          replica->data[q].z = REPLICA_IDLE;                                                         // Setting idle replica...
+          running--;                                                                                 // Updating number of running replicas...
+        }
+      }
+
+      // STARTING NEXT SWEEP BATCH (all replicas idle: new fields and coupling table, same kernels and mesh):
+      if(sweeping && (running == 0) && (trial_index < (unsigned int)trials))
+      {
+        point               = plan->point (trial_index);                                             // Getting first point of the batch...
+        trial_limit         = plan->batch_end (trial_index);                                         // Setting trials available...
+        warm_theta          = warm_next;                                                             // Setting warm-start theta...
+        parameter->data[2]  = plan->Hx (point);                                                      // Setting longitudinal magnetic field parameter...
+        parameter->data[3]  = plan->Hz (point);                                                      // Setting transverse magnetic field parameter...
+
+        if(plan->alpha (point) != parameter->data[0])
+        {
+          parameter->data[0] = plan->alpha (point);                                                  // Setting radial exponent parameter...
+          coupling->data     = sb::coupling (edge, ds, parameter->data[0]);                          // Computing coupling table...
+          cl->write (12);                                                                            // Updating coupling table...
+
+          if(long_mode)
+          {
+            coupling_spectrum->data = sb::long_range_spectrum (
+                                                               grid_columns,
+                                                               grid_rows,
+                                                               spacing,
+                                                               parameter->data[0]
+                                                              );                                     // Computing long-range coupling spectrum...
+            cl->write (22);                                                                          // Updating long-range coupling spectrum...
+          }
+        }
+
+        cl->write (11);                                                                              // Updating all parameters...
+        std::cout << "sweep batch: Hx = " << parameter->data[2] << ", Hz = " << parameter->data[3]
+                  << ", alpha = " << parameter->data[0] << "." << std::endl;                         // Printing message...
+
+        for(q = 0; (q < replicas) && (trial_index < trial_limit); q++)
+        {
+          point                = plan->point (trial_index);                                          // Getting sweep point...
+          start                = (warm && !warm_theta[plan->rung (point)].empty ()) ?
+                                 &warm_theta[plan->rung (point)] : &upload_theta;                    // Setting initial theta...
+          temperature->data[q] = plan->T (point);                                                    // Setting sweep point temperature...
+
+          for(i = 0; i < nodes; i++)
+          {
+            theta_value[q*nodes + i] = (*start)[i];                                                  // Setting initial theta...
+          }
+
+          replica->data[q] = {0, (int)trial_index, REPLICA_RUNNING, 0};                              // Assigning trial to replica...
+          trial_index++;                                                                             // Updating trial index...
+          running++;                                                                                 // Updating number of running replicas...
+        }
+      }
+
+      if(sweeping)
+      {
+        cl->write (19);                                                                              // Updating replica temperatures...
+      }
+
+      theta_int_value = theta_value;                                                                 // Setting theta (intermediate value)...
+      sb::pack_angles (theta_value, theta->data);                                                    // Packing theta...
+      sb::pack_angles (theta_int_value, theta_int->data);                                            // Packing theta (intermediate value)...
+      prof->begin ("upload");                                                                        // Starting transfer timer...
+      cl->write (3);                                                                                 // Updating theta...
+      cl->write (4);                                                                                 // Updating theta (intermediate)...
+      cl->write (17);                                                                                // Updating replica states...
+      prof->end ("upload");                                                                          // Stopping transfer timer...
+      prof->end ("snapshot");                                                                        // Stopping snapshot timer...
+    }
+
+    // SAVING CHECKPOINT (every "checkpoint_trials" trials and/or every "checkpoint_time" seconds):
+    if(((ckpt_trials > 0) && (trial_index >= ckpt_trial + ckpt_trials)) ||
+       ((ckpt_time > 0) && (difftime (time (NULL), ckpt_clock) >= ckpt_time)))
+    {
+      prof->begin ("checkpoint");                                                                    // Starting checkpoint timer...
+      prof->begin ("download");                                                                      // Starting transfer timer...
+      cl->read (3);                                                                                  // Reading theta...
+      cl->read (4);                                                                                  // Reading theta (intermediate)...
+
+      if(rng_mode == RNG_XOSHIRO)
+      {
+        cl->read (5);                                                                                // Reading random generator state...
+        cl->read (6);                                                                                // Reading random generator state...
+      }
+      cl->read (9);                                                                                  // Reading rejection sampling iterations...
+      cl->read (16);                                                                                 // Reading step counter...
+      prof->end ("download");                                                                        // Stopping transfer timer...
+      sb::unpack_angles (theta->data, theta_value);                                                  // Expanding theta...
+      sb::unpack_angles (theta_int->data, theta_int_value);                                          // Expanding theta (intermediate value)...
+
+      ckpt_value = hash;                                                                             // Setting mesh hash...
+      ckpt->clear ();                                                                                // Resetting checkpoint...
+      ckpt->set ("hash", &ckpt_value, sizeof (ckpt_value));                                          // Setting mesh hash...
+      ckpt->set ("order", order.data (), nodes*sizeof (int));                                        // Setting node order...
+      ckpt->set ("parameter", parameter->data.data (), parameter->data.size ()*sizeof (float));      // Setting parameters...
+      ckpt->set ("temperature", temperature->data.data (), replicas*sizeof (float));                 // Setting replica temperatures...
+      ckpt->set ("replica", replica->data.data (), replicas*sizeof (replica->data[0]));              // Setting replica states...
+      ckpt->set ("theta", theta_value.data (), nodes*replicas*sizeof (float));                       // Setting theta...
+      ckpt->set ("theta_int", theta_int_value.data (), nodes*replicas*sizeof (float));               // Setting theta (intermediate value)...
+      ckpt->set ("state_theta", state_theta->data.data (),
+                 state_theta->data.size ()*sizeof (state_theta->data[0]));                           // Setting random generator state...
+      ckpt->set ("state_threshold", state_threshold->data.data (),
+                 state_threshold->data.size ()*sizeof (state_threshold->data[0]));                   // Setting random generator state...
+      ckpt->set ("m_overflow", m_overflow->data.data (),
+                 m_overflow->data.size ()*sizeof (int));                                             // Setting rejection sampling iterations...
+      ckpt->set ("step", step->data.data (), sizeof (int));                                          // Setting step counter...
+      ckpt->set ("trial_index", &trial_index, sizeof (trial_index));                                 // Setting trial index...
+      ckpt->set ("step_index", &step_index, sizeof (step_index));                                    // Setting step index...
+      ckpt->set ("running", &running, sizeof (running));                                             // Setting number of running replicas...
+
+      stat_state.clear ();                                                                           // Resetting statistics state...
+
+      for(q = 0; q < replicas; q++)
+      {
+        stat_replica = stat[q].state ();                                                             // Getting replica statistics...
+        stat_state.insert (stat_state.end (), stat_replica.begin (), stat_replica.end ());           // Adding replica statistics...
+      }
+
+      ckpt->set ("statistics", stat_state.data (), stat_state.size ()*sizeof (double));              // Setting statistics state...
+
+      if(tempering)
+      {
+        ladder_state = ladder->state ();                                                             // Getting temperature ladder state...
+        ckpt->set ("tempering", ladder_state.data (), ladder_state.size ());                         // Setting temperature ladder state...
+      }
+
+      ckpt->save (ckpt_file);                                                                        // Saving checkpoint...
+      ckpt_trial = trial_index;                                                                      // Updating trial index at last checkpoint...
+      ckpt_clock = time (NULL);                                                                      // Updating wall-clock time at last checkpoint...
+      prof->end ("checkpoint");                                                                      // Stopping checkpoint timer...
+      std::cout << "checkpoint saved to " << ckpt_file << " (step " << step_index << ")."
+                << std::endl;                                                                        // Printing message...
+    }
+
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  /////////////////////////////////////// CLOSING DATA LOG FILE //////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  log->close (nu::WRITE);                                                                            // Closing data log file...
+  stat_log->close (nu::WRITE);                                                                       // Closing statistics log file...
+
+  if(decay)
+  {
+    decay_log->close (nu::WRITE);                                                                    // Closing decay log file...
+  }
+
+  // WRITING SWEEP RESULT TABLE (one line per point of this job):
+  if(sweeping)
+  {
+    sweep_log->open (output + SWEEP_FILE + timestamp, LOG_EXT, LOG_HEAD, "\t", nu::WRITE);           // Opening sweep result table...
+    sweep_log->write ("#point");                                                                     // Logging header...
+    sweep_log->write ("#T");                                                                         // Logging header...
+    sweep_log->write ("#Hx");                                                                        // Logging header...
+    sweep_log->write ("#Hz");                                                                        // Logging header...
+    sweep_log->write ("#alpha");                                                                     // Logging header...
+    sweep_log->write ("#trials");                                                                    // Logging header...
+    sweep_log->write ("#sz_avg");                                                                    // Logging header...
+    sweep_log->write ("#sz_stderr");                                                                 // Logging header...
+    sweep_log->write ("#sz_tau");                                                                    // Logging header...
+    sweep_log->write ("#sz_samples");                                                                // Logging header...
+    sweep_log->write ("#energy");                                                                    // Logging header...
+    sweep_log->write ("#decayed");                                                                   // Logging header...
+    sweep_log->endline ();                                                                           // Logging header...
+
+    for(point = plan->first_point (); point < plan->last_point (); point++)
+    {
+      sweep_log->write ((unsigned int)point);                                                        // Logging point...
+      sweep_log->write (plan->T (point));                                                            // Logging temperature...
+      sweep_log->write (plan->Hx (point));                                                           // Logging longitudinal magnetic field...
+      sweep_log->write (plan->Hz (point));                                                           // Logging transverse magnetic field...
+      sweep_log->write (plan->alpha (point));                                                        // Logging radial exponent...
+      sweep_log->write ((unsigned int)plan->trials (point));                                         // Logging finished trials...
+      sweep_log->write (plan->sz (point));                                                           // Logging average z-spin...
+      sweep_log->write (plan->sz_stderr (point));                                                    // Logging average z-spin standard error...
+      sweep_log->write (plan->sz_tau (point));                                                       // Logging average z-spin autocorrelation time...
+      sweep_log->write (plan->sz_samples (point));                                                   // Logging average z-spin effective samples...
+      sweep_log->write (plan->energy (point));                                                       // Logging energy per node...
+      sweep_log->write (plan->decayed (point));                                                      // Logging decay fraction...
+      sweep_log->endline ();                                                                         // Ending log line...
+    }
+
+    sweep_log->close (nu::WRITE);                                                                    // Closing sweep result table...
+    std::cout << "sweep results written to " << output << SWEEP_FILE << timestamp << "."
+              << std::endl;                                                                          // Printing message...
+  }
+
+  prof->print ();                                                                                    // Printing timing statistics...
+
+  if(tempering)
+  {
+    for(k = 0; (k + 1) < ladder->rungs (); k++)
+    {
+      std::cout << "T = " << ladder->rung_temperature (k) << " <-> T = "
+                << ladder->rung_temperature (k + 1) << ": swap acceptance = "
+                << ladder->acceptance (k) << std::endl;                                              // Printing message...
+    }
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  /////////////////////////////////////////////// CLEANUP ////////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  delete cl;                                                                                         // Deleting OpenCL context...
+  delete position;                                                                                   // Deleting position data...
+  delete neighbour;                                                                                  // Deleting neighbours...
+  delete offset;                                                                                     // Deleting offset...
+  delete coupling;                                                                                   // Deleting coupling table...
+  delete colour_node;                                                                                // Deleting colour classes...
+  delete colour_offset;                                                                              // Deleting colour class offsets...
+  delete observable;                                                                                 // Deleting observables...
+  delete step;                                                                                       // Deleting step counter...
+  delete replica;                                                                                    // Deleting replica state...
+  delete energy_partial;                                                                             // Deleting energy partial summation...
+  delete iteration_part;                                                                             // Deleting rejection sampling iterations partial summation...
+  delete grid_node;                                                                                  // Deleting structured grid...
+  delete domain;                                                                                     // Deleting partition...
+  delete exchange;                                                                                   // Deleting halo exchange...
+  delete spectrum;                                                                                   // Deleting long-range field spectrum...
+  delete coupling_spectrum;                                                                          // Deleting long-range coupling spectrum...
+  delete long_range;                                                                                 // Deleting long-range field...
+  delete halo;                                                                                       // Deleting halo values...
+  delete halo_node;                                                                                  // Deleting boundary nodes...
+  delete temperature;                                                                                // Deleting replica temperature...
+  delete theta;                                                                                      // Deleting theta...
+  delete theta_int;                                                                                  // Deleting theta (intermediate)...
+  delete state_theta;                                                                                // Deleting random generator state...
+  delete state_threshold;                                                                            // Deleting random generator state...
+  delete spin_z_partial;                                                                             // Deleting z-spin partial summation...
+  delete spin_z2_partial;                                                                            // Deleting z-spin square partial summation...
+  delete m_overflow;                                                                                 // Deleting rejection sampling iterations...
+  delete m_overflow_part;                                                                            // Deleting rejection sampling overflow partial summation...
+  delete parameter;                                                                                  // Deleting parameters...
+  delete K0;                                                                                         // Deleting OpenCL kernel...
+  delete K1;                                                                                         // Deleting OpenCL kernel...
+  delete K2;                                                                                         // Deleting OpenCL kernel...
+  delete K3;                                                                                         // Deleting OpenCL kernel...
+  delete K5;                                                                                         // Deleting OpenCL kernel...
+  delete K6;                                                                                         // Deleting OpenCL kernel...
+  delete K7;                                                                                         // Deleting OpenCL kernel...
+  delete K8;                                                                                         // Deleting OpenCL kernel...
+  delete K9;                                                                                         // Deleting OpenCL kernel...
+  delete K10;                                                                                        // Deleting OpenCL kernel...
+  delete K11;                                                                                        // Deleting OpenCL kernel...
+
+  for(c = 0; c < K4.size (); c++)
+  {
+    delete K4[c];                                                                                    // Deleting OpenCL kernel (colour phase)...
+  }
+
+  delete vacuum;                                                                                     // Deleting vacuum mesh...
+  delete grid;                                                                                       // Deleting vacuum lattice...
+  delete topo;                                                                                       // Deleting vacuum topology...
+  delete log;                                                                                        // Deleting log file object...
+  delete decay_log;                                                                                  // Deleting log file object...
+  delete sweep_log;                                                                                  // Deleting log file object...
+  delete stat_log;                                                                                   // Deleting log file object...
+  delete plan;                                                                                       // Deleting parameter sweep...
+  delete snapshot;                                                                                   // Deleting snapshot file object...
+  delete snapshot_in;                                                                                // Deleting snapshot file object...
+  delete upload;                                                                                     // Deleting log file object...
+  delete ladder;                                                                                     // Deleting temperature ladder...
+  delete ckpt;                                                                                       // Deleting checkpoint...
+  delete prof;                                                                                       // Deleting profiler...
+  delete cfg;                                                                                        // Deleting configuration...
+
+  return 0;
+}
@@ -0,0 +1,27 @@
+/// @file     angle.cl
+/// @date     16OCT2026
+/// @brief    16-bit fixed-point angles.
+/// @details  Theta is stored on the device as a 16-bit fixed-point fraction of a turn
+///           (theta/2pi*65536, modulo 65536): two angles per 32-bit word, a resolution of
+///           2pi/65536 ~ 1e-4 rad. The kernels decode it to float before any arithmetic and encode
+///           the new value, the host expands it to float for snapshots, checkpoints and halos.
+///           This file is compiled both as OpenCL C (after utilities.cl) and as C++ (included by
+///           Code/common/angle.cpp, see angle.hpp): plain C, float arithmetic only.
+
+#ifndef __OPENCL_VERSION__
+#define M_PI_F 3.14159274101257f                                                // Pi (float, as in OpenCL C).
+#endif
+
+#define ANGLE_STEPS 65536.0f                                                    // Fixed-point steps per turn.
+
+// Angle encoding function (nearest fixed-point step of "theta", of any turn):
+ushort angle_encode(float theta)                                                // Theta.
+{
+  return (ushort)((int)rint(theta*(ANGLE_STEPS/(2.0f*M_PI_F))) & 0xFFFF);       // Encoding theta...
+}
+
+// Angle decoding function (theta in [0, 2pi)):
+float angle_decode(ushort a)                                                    // Fixed-point angle.
+{
+  return (float)a*(2.0f*M_PI_F/ANGLE_STEPS);                                    // Decoding theta...
+}
@@ -0,0 +1,71 @@
+/// @file     fft.cl
+/// @date     16OCT2026
+/// @brief    Radix-2 FFT.
+/// @details  Shared by the long-range field kernels (thekernel_7.cl, thekernel_8.cl, thekernel_9.cl,
+///           see long_range.hpp). Each work-item transforms one whole grid row or column in place, in
+///           global memory (interleaved real and imaginary parts): the transforms of all rows (or
+///           columns) and replicas run in parallel, with no work-group synchronization.
+
+// In-place radix-2 FFT of "n" complex values at "data", "data + 2*stride", ... (n power of two,
+// sign = -1 forward, +1 inverse, not normalised):
+void fft(__global float* data,                                                  // Interleaved complex values.
+         uint            n,                                                     // Number of values.
+         uint            stride,                                                // Value stride.
+         float           sign)                                                  // Transform sign.
+{
+  uint  i;                                                                      // Value index.
+  uint  j = 0;                                                                  // Bit-reversed value index.
+  uint  k;                                                                      // Twiddle index.
+  uint  bit;                                                                    // Bit-reversal bit.
+  uint  length;                                                                 // Butterfly span.
+  uint  a;                                                                      // Butterfly upper value index.
+  uint  b;                                                                      // Butterfly lower value index.
+  float re;                                                                     // Real part.
+  float im;                                                                     // Imaginary part.
+  float w_re;                                                                   // Twiddle real part.
+  float w_im;                                                                   // Twiddle imaginary part.
+
+  // REORDERING VALUES (bit reversal):
+  for (i = 1; i < n; i++)
+  {
+    for (bit = n >> 1; j & bit; bit >>= 1)
+    {
+      j ^= bit;                                                                 // Clearing bit...
+    }
+
+    j ^= bit;                                                                   // Setting bit...
+
+    if (i < j)
+    {
+      a = 2*i*stride;                                                           // Getting value index...
+      b = 2*j*stride;                                                           // Getting bit-reversed value index...
+      re = data[a];                                                             // Swapping values...
+      im = data[a + 1];                                                         // Swapping values...
+      data[a] = data[b];                                                        // Swapping values...
+      data[a + 1] = data[b + 1];                                                // Swapping values...
+      data[b] = re;                                                             // Swapping values...
+      data[b + 1] = im;                                                         // Swapping values...
+    }
+  }
+
+  // COMBINING BUTTERFLIES OF INCREASING SPAN (one twiddle per butterfly column):
+  for (length = 2; length <= n; length <<= 1)
+  {
+    for (k = 0; k < length/2; k++)
+    {
+      w_im = sincos(sign*2.0f*M_PI_F*k/length, &w_re);                          // Computing twiddle...
+
+      for (i = k; i < n; i += length)
+      {
+        a = 2*i*stride;                                                         // Getting upper value index...
+        b = 2*(i + length/2)*stride;                                            // Getting lower value index...
+        re = w_re*data[b] - w_im*data[b + 1];                                   // Twiddling lower value...
+        im = w_re*data[b + 1] + w_im*data[b];                                   // Twiddling lower value...
+        data[b] = data[a] - re;                                                 // Setting lower value...
+        data[b + 1] = data[a + 1] - im;                                         // Setting lower value...
+        data[a] += re;                                                          // Setting upper value...
+        data[a + 1] += im;                                                      // Setting upper value...
+      }
+    }
+  }
+}
@@ -0,0 +1,64 @@
+/// @file     heatbath.cl
+/// @date     16OCT2026
+/// @brief    Heat-bath (von Mises) draw.
+/// @details  Best-Fisher draw of p(psi) ~ exp(kappa*cos(psi)): rejection from a wrapped Cauchy
+///           envelope, acceptance above 65% for any kappa. Each iteration takes a flat angle and a
+///           flat threshold, like one rejection sampling iteration. The deviation psi is computed
+///           without cancellation, so that the tails keep their weight at large kappa.
+///           This file is compiled both as OpenCL C (source of the update kernels, before
+///           metropolis.cl) and as C++ (included by Code/common/heatbath.cpp, see heatbath.hpp), so
+///           that the host tests run the code of the kernels: plain C, float arithmetic only.
+
+#ifndef __OPENCL_VERSION__
+#define M_PI_F 3.14159274101257f                                                // Pi (float, as in OpenCL C).
+#endif
+
+#define HEATBATH_KAPPA_MIN 1.0e-6f                                              // Flat draw concentration threshold.
+
+// Von Mises envelope function (sets the wrapped Cauchy envelope s - 1 and s + 1 for concentration
+// "kappa"; returns "false" below HEATBATH_KAPPA_MIN, where the density is flat within float precision):
+bool von_mises_envelope(float  kappa,                                           // Concentration.
+                        float* s_minus,                                         // Envelope s - 1.
+                        float* s_plus)                                          // Envelope s + 1.
+{
+  float q;                                                                      // Envelope auxiliary.
+  float rho;                                                                    // Wrapped Cauchy envelope concentration.
+
+  if (kappa < HEATBATH_KAPPA_MIN)
+  {
+    return false;
+  }
+
+  q = sqrt(1.0f + 4.0f*kappa*kappa);                                            // Computing envelope auxiliary...
+  rho = 2.0f*kappa/(1.0f + q + sqrt(2.0f*(1.0f + q)));                          // Computing envelope concentration...
+  *s_minus = (1.0f - rho)*(1.0f - rho)/(2.0f*rho);                              // Computing envelope s - 1...
+  *s_plus = (1.0f + rho)*(1.0f + rho)/(2.0f*rho);                               // Computing envelope s + 1...
+
+  return true;
+}
+
+// Von Mises iteration function (one Best-Fisher iteration from a flat theta in [0, 2pi) and a flat
+// threshold in [0, 1]; returns "true" if the candidate is accepted, then sets "*psi" to the deviation
+// from the local field direction, in [-pi, pi]):
+bool von_mises(float  kappa,                                                    // Concentration.
+               float  s_minus,                                                  // Envelope s - 1.
+               float  s_plus,                                                   // Envelope s + 1.
+               float  theta_rand,                                               // Flat random theta.
+               float  threshold_rand,                                           // Flat random threshold.
+               float* psi)                                                      // Deviation.
+{
+  float z = cos(theta_rand);                                                    // Cosine of the flat random theta.
+  float y = kappa*s_minus*s_plus/(1.0f + s_minus + z);                          // Acceptance variable (kappa*(s - cos(psi))).
+
+  if (!((y*(2.0f - y) > threshold_rand) || (log(y/threshold_rand) + 1.0f - y >= 0.0f)))
+  {
+    return false;
+  }
+
+  // COMPUTING DEVIATION (sin(psi/2) without cancellation, sign from the half of the flat theta):
+  *psi = sin(0.5f*theta_rand)*sqrt(s_minus/(1.0f + s_minus + z));              // Computing sin(psi/2)...
+  *psi = 2.0f*asin(min(*psi, 1.0f));                                            // Computing deviation...
+  *psi = (theta_rand < M_PI_F) ? *psi : -*psi;                                  // Setting deviation sign...
+
+  return true;
+}
@@ -0,0 +1,225 @@
+/// @file     metropolis.cl
+/// @date     16OCT2026
+/// @brief    Metropolis single-site update.
+/// @details  Shared by the Jacobi (thekernel_1.cl, thekernel_6.cl) and graph-coloured (thekernel_4.cl)
+///           update kernels. The new theta is drawn either by rejection sampling (up to m_max flat
+///           proposals) or by heat-bath (exact von Mises draw of the local field, Best-Fisher
+///           algorithm in heatbath.cl: about 1.5 iterations at worst on average).
+///           The random generator is either xoshiro128++ (two per-node states, loaded and stored by
+///           the caller) or Philox4x32-10 (stateless, counter = (node, sweep, trial, block) and
+///           key = (seed, replica)): one Philox block feeds two rejection iterations.
+
+// Random generator:
+typedef struct
+{
+  uint  mode;                                                                   // Random generator mode.
+  uint4 st_theta;                                                               // xoshiro128++ state (theta).
+  uint4 st_threshold;                                                           // xoshiro128++ state (threshold).
+  uint4 counter;                                                                // Philox counter (node, sweep, trial, block).
+  uint2 key;                                                                    // Philox key (seed, replica).
+  uint4 block;                                                                  // Philox current output block.
+} generator;
+
+// Random pair function (theta in [0, 2pi), threshold in [0, 1]) for rejection iteration "m":
+void random_pair(generator* rng,                                                // Random generator.
+                 uint       m,                                                  // Rejection index.
+                 float*     theta_rand,                                         // Flat random theta.
+                 float*     threshold_rand)                                     // Flat random threshold.
+{
+  uint theta_bits;                                                              // Random theta bits.
+  uint threshold_bits;                                                          // Random threshold bits.
+
+  if (rng->mode == RNG_PHILOX)
+  {
+    // GENERATING A NEW BLOCK EVERY TWO ITERATIONS:
+    if ((m & 1) == 0)
+    {
+      rng->counter.w = m >> 1;                                                  // Setting block index...
+      rng->block = philox4x32_10(rng->counter, rng->key);                       // Generating random block...
+    }
+
+    theta_bits = ((m & 1) == 0) ? rng->block.x : rng->block.z;                  // Picking random theta bits...
+    threshold_bits = ((m & 1) == 0) ? rng->block.y : rng->block.w;              // Picking random threshold bits...
+  }
+  else
+  {
+    theta_bits = xoshiro128pp(&rng->st_theta);                                  // Generating random theta bits...
+    threshold_bits = xoshiro128pp(&rng->st_threshold);                          // Generating random threshold bits...
+  }
+
+  *theta_rand = uint_to_float(theta_bits, 0.0f, 2.0f*M_PI_F);                   // Generating random theta (flat distribution)...
+  *threshold_rand = uint_to_float(threshold_bits, 0.0f, +1.0f);                 // Generating random threshold (flat distribution)...
+}
+
+// Central node energy function (the neighbour contribution enters as a local transverse field):
+float E_central(float Hx, float Hz, float theta_central)
+{
+  float E;                                                                      // Energy.
+  
+  E = -(Hx*cos(theta_central) + Hz*sin(theta_central));                         // Computing energy...
+
+  return E;
+}
+
+// Neighbour node function (compact: 16-bit delta from node "n", modulo the number of nodes):
+uint neighbour_node(__global int* neighbour,                                    // Neighbour.
+                    uint          j,                                            // Neighbour stride index.
+                    uint          n,                                            // Node index.
+                    uint          nodes,                                        // Number of nodes.
+                    uint          compact)                                      // Compact neighbour indices.
+{
+  int k;                                                                        // Neighbour node index.
+
+  if (!compact)
+  {
+    return (uint)neighbour[j];                                                  // Getting neighbour node index...
+  }
+
+  k = (int)n + (int)((__global short*)neighbour)[j];                            // Decoding neighbour node delta...
+
+  if (k < 0)
+  {
+    k += (int)nodes;                                                            // Wrapping neighbour node index...
+  }
+
+  if (k >= (int)nodes)
+  {
+    k -= (int)nodes;                                                            // Wrapping neighbour node index...
+  }
+
+  return (uint)k;
+}
+
+// Neighbour local field function:
+float local_field(__global int*   neighbour,                                    // Neighbour.
+                  __global float* coupling,                                     // Coupling table.
+                  __global ushort* theta,                                       // Theta (16-bit fixed point).
+                  uint            n,                                            // Node index.
+                  uint            nodes,                                        // Number of nodes.
+                  uint            compact,                                      // Compact neighbour indices.
+                  uint            j_min,                                        // Neighbour stride minimum index.
+                  uint            j_max)                                        // Neighbour stride maximum index.
+{
+  uint  j;                                                                      // Neighbour stride index.
+  uint  k;                                                                      // Neighbour node index.
+  float h = 0.0f;                                                               // Neighbour local field.
+
+  for (j = j_min; j < j_max; j++)
+  {
+    k = neighbour_node(neighbour, j, n, nodes, compact);                        // Getting neighbour node index...
+    h += coupling[j]*sin(angle_decode(theta[k]));                               // Accumulating neighbour local field...
+  }
+
+  return h;
+}
+
+// Rejection sampling function (returns the new theta, sets "*m" to the number of iterations):
+float metropolis(float      theta_central,                                      // Current theta.
+                 float      h,                                                  // Neighbour local field.
+                 float      T,                                                  // Temperature.
+                 float      Hx,                                                 // Longitudinal magnetic field.
+                 float      Hz,                                                 // Transverse magnetic field.
+                 uint       m_max,                                              // Maximum allowed number of rejections.
+                 generator* rng,                                                // Random generator.
+                 uint*      m)                                                  // Rejection index.
+{
+  float E;                                                                      // Energy function.
+  float En;                                                                     // Energy of central node.
+  float theta_rand;                                                             // Flat random theta.
+  float threshold_rand;                                                         // Flat random threshold.
+  float D;                                                                      // Distributed random z-spin.
+
+  En = E_central(Hx, Hz + h, theta_central);                                    // Computing energy on central theta...
+  *m = 0;                                                                       // Resetting rejection index...
+
+  // COMPUTING RANDOM Z-SPIN FROM DISTRIBUTION (rejection sampling):
+  do
+  {
+    random_pair(rng, *m, &theta_rand, &threshold_rand);                         // Generating random theta and threshold (flat distribution)...
+    E = E_central(Hx, Hz + h, theta_rand);                                      // Computing energy on random theta...
+    D = 1.0f/(1.0f + exp((E - En)/T));                                          // Computing new z-spin candidate from distribution...
+    (*m)++;                                                                     // Updating rejection index...
+  }
+  while ((threshold_rand > D) && (*m < m_max));                                 // Evaluating new z-spin candidate (discarding if not found before m_max iterations)...
+
+  // EVALUATING REJECTION SAMPLING RESULT:
+  if (*m < m_max)
+  {
+    return theta_rand;                                                          // Accepting new theta...
+  }
+
+  return theta_central;                                                         // Keeping current theta...
+}
+
+// Heat-bath function (draws theta from exp(kappa*cos(theta - phi)) exactly, Best-Fisher algorithm):
+float heatbath(float      theta_central,                                        // Current theta.
+               float      h,                                                    // Neighbour local field.
+               float      T,                                                    // Temperature.
+               float      Hx,                                                   // Longitudinal magnetic field.
+               float      Hz,                                                   // Transverse magnetic field.
+               uint       m_max,                                                // Maximum allowed number of iterations.
+               generator* rng,                                                  // Random generator.
+               uint*      m)                                                    // Iteration index.
+{
+  float theta_rand;                                                             // Flat random theta.
+  float threshold_rand;                                                         // Flat random threshold.
+  float H_z = Hz + h;                                                           // Local transverse field.
+  float kappa = sqrt(Hx*Hx + H_z*H_z)/T;                                        // Concentration.
+  float phi = atan2(H_z, Hx);                                                   // Local field direction.
+  float s_minus;                                                                // Envelope s - 1.
+  float s_plus;                                                                 // Envelope s + 1.
+  bool  accepted = false;                                                       // Acceptance flag.
+  float psi;                                                                    // Deviation from the local field direction.
+  float theta_new;                                                              // New theta.
+
+  *m = 0;                                                                       // Resetting iteration index...
+
+  // DRAWING A FLAT THETA (vanishing concentration, density flat within float precision):
+  if (!von_mises_envelope(kappa, &s_minus, &s_plus))
+  {
+    random_pair(rng, 0, &theta_rand, &threshold_rand);                          // Generating random theta (flat distribution)...
+    *m = 1;                                                                     // Updating iteration index...
+
+    return theta_rand;
+  }
+
+  // DRAWING A WRAPPED CAUCHY CANDIDATE UNTIL ACCEPTED (about 1.5 iterations at worst, on average):
+  do
+  {
+    random_pair(rng, *m, &theta_rand, &threshold_rand);                         // Generating random theta and threshold (flat distribution)...
+    accepted = von_mises(kappa, s_minus, s_plus, theta_rand, threshold_rand,
+                         &psi);                                                 // Evaluating candidate (deviation if accepted)...
+    (*m)++;                                                                     // Updating iteration index...
+  }
+  while (!accepted && (*m < m_max));                                            // Bounding iterations (m_max = overflow, as rejection sampling)...
+
+  if (*m >= m_max)
+  {
+    return theta_central;                                                       // Keeping current theta...
+  }
+
+  // WRAPPING NEW THETA IN [0, 2pi):
+  theta_new = phi + psi;                                                        // Computing new theta...
+  theta_new -= 2.0f*M_PI_F*floor(theta_new/(2.0f*M_PI_F));                      // Wrapping new theta...
+
+  return theta_new;
+}
+
+// Single-site sampling function (returns the new theta, sets "*m" to the number of rejections):
+float sample_theta(uint            sampler,                                     // Single-site sampler.
+                   float           theta_central,                               // Current theta.
+                   float           h,                                           // Neighbour local field.
+                   float           T,                                           // Temperature.
+                   float           Hx,                                          // Longitudinal magnetic field.
+                   float           Hz,                                          // Transverse magnetic field.
+                   uint            m_max,                                       // Maximum allowed number of rejections.
+                   generator*      rng,                                         // Random generator.
+                   uint*           m)                                           // Rejection index.
+{
+  if (sampler == SAMPLER_HEATBATH)
+  {
+    return heatbath(theta_central, h, T, Hx, Hz, m_max, rng, m);                // Drawing new theta...
+  }
+
+  return metropolis(theta_central, h, T, Hx, Hz, m_max, rng, m);                // Sampling new theta...
+}
@@ -1,20 +1,33 @@
 /// @file
 #define RAMP_UP_CYCLES 1000
 
-__kernel void thekernel(__global float4*    color,                              // Color.
-                        __global float4*    position,                           // Position.
-                        __global int*       central,                            // Node.
+__kernel void thekernel(__global float4*    position,                           // Position.
                         __global int*       neighbour,                          // Neighbour.
                         __global int*       offset,                             // Offset. 
-                        __global float*     theta,                              // Theta.  
-                        __global float*     theta_int,                          // Theta (intermediate value). 
+                        __global ushort*    theta,                              // Theta (16-bit fixed point, see angle.cl).
+                        __global ushort*    theta_int,                          // Theta (intermediate value, 16-bit fixed point).
                         __global int4*      state_theta,                        // Random number generator state.
                         __global int4*      state_threshold,                    // Random number generator state. 
-                        __global float*     spin_z_row_sum,                     // z-spin row summation.
-                        __global float*     spin_z2_row_sum,                    // z-spin square row summation.
-                        __global int*       m_overflow,                         // Rejection sampling overflow.
-                        __global int*       m_overflow_sum,                     // Rejection sampling overflow sum.
-                        __global float*     parameter)                          // Parameters.
+                        __global float*     spin_z_partial,                     // z-spin partial summation.
+                        __global float*     spin_z2_partial,                    // z-spin square partial summation.
+                        __global ushort*    m_overflow,                         // Rejection sampling iterations (16-bit counts).
+                        __global int*       m_overflow_partial,                 // Rejection sampling overflow partial summation.
+                        __global float*     parameter,                          // Parameters.
+                        __global float*     coupling,                           // Coupling table.
+                        __global int*       colour_node,                        // Nodes sorted by colour.
+                        __global int*       colour_offset,                      // Colour class offsets.
+                        __global float*     observable,                         // Observables (ring buffer).
+                        __global int*       step,                               // Step counter.
+                        __global int4*      replica,                            // Replica state (step, trial, status, decay).
+                        __global float*     energy_partial,                     // Energy partial summation.
+                        __global float*     temperature,                        // Replica temperature.
+                        __global int*       grid,                               // Structured grid (node of each grid cell, row by row).
+                        __global float*     spectrum,                           // Long-range field spectrum (sin(theta) transform, grid order).
+                        __global float*     coupling_spectrum,                  // Long-range coupling spectrum (scaled transform of J).
+                        __global float*     long_range,                         // Long-range field (node order).
+                        __global float*     halo,                               // Halo values (boundary, then ghost theta).
+                        __global int*       halo_node,                          // Boundary nodes (slice indices).
+                        __global float*     iteration_partial)                  // Rejection sampling iterations partial summation.
 { 
   ////////////////////////////////////////////////////////////////////////////////
   //////////////////////////////////// INDICES ///////////////////////////////////
@@ -22,26 +35,26 @@ __kernel void thekernel(__global float4*    color,
   uint         i = get_global_id(0);                                            // Global index [#].
   uint         j = 0;                                                           // Neighbour stride index.
   uint         j_min = 0;                                                       // Neighbour stride minimun index.
-  uint         j_max = offset[i];                                               // Neighbour stride maximum index.
   uint         k = 0;                                                           // Neighbour tuple index.
-  uint         n = central[j_max - 1];                                          // Node index.    
   uint         m = 0;                                                           // Rejection index.      
   uint         r = 0;                                                           // Ramp-up index.
+  uint         q = get_global_id(1);                                            // Replica index [#].
+  uint         u = q*SB_NODES + i;                                              // Replica node index (the node is the slice row).
 
   ////////////////////////////////////////////////////////////////////////////////
   //////////////////////////////// RANDOM GENERATOR //////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////
   float        sz_rand           = 0.0f;                                        // Flat tandom z-spin.
   float        th_rand           = 0.0f;                                        // Flat random threshold.
-  uint4        st_sz             = convert_uint4(state_theta[n]);               // Random generator state.
-  uint4        st_th             = convert_uint4(state_threshold[n]);           // Random generator state.
+  uint4        st_sz             = convert_uint4(state_theta[u]);               // Random generator state.
+  uint4        st_th             = convert_uint4(state_threshold[u]);           // Random generator state.
 
   // RAMPING UP RANDOM GENERATORS:
   for (r = 0; r < RAMP_UP_CYCLES; r++)
   {
     sz_rand = uint_to_float(xoshiro128pp(&st_sz), -1.0f, +1.0f);                // Generating random z-spin (flat distribution)...
     th_rand = uint_to_float(xoshiro128pp(&st_th), 0.0f, +1.0f);                 // Generating random threshold (flat distribution)...  
-    state_theta[n] = convert_int4(st_sz);                                       // Updating random generator state...
-    state_threshold[n] = convert_int4(st_th);                                   // Updating random generator state...
+    state_theta[u] = convert_int4(st_sz);                                       // Updating random generator state...
+    state_threshold[u] = convert_int4(st_th);                                   // Updating random generator state...
   }
 }
@@ -1,39 +1,32 @@
 /// @file
 
-// Central node energy function:
-float E_central(float Hx, float Hz, float theta_central)
-{
-  float E;                                                                      // Energy.
-  
-  E = -(Hx*cos(theta_central) + Hz*sin(theta_central));                         // Computing energy...
-
-  return E;
-}
-
-// Neighbour node energy function:
-float E_neighbour(float C_radial, float theta_neighbour, float theta_central)
-{
-  float E;                                                                      // Energy.
-  
-  E = -(C_radial*sin(theta_neighbour)*sin(theta_central));                      // Computing energy...
-
-  return E;
-}
-
-__kernel void thekernel(__global float4*    color,                              // Color.
-                        __global float4*    position,                           // Position.
-                        __global int*       central,                            // Node.
+__kernel void thekernel(__global float4*    position,                           // Position.
                         __global int*       neighbour,                          // Neighbour.
                         __global int*       offset,                             // Offset. 
-                        __global float*     theta,                              // Theta.  
-                        __global float*     theta_int,                          // Theta (intermediate value). 
+                        __global ushort*    theta,                              // Theta (16-bit fixed point, see angle.cl).
+                        __global ushort*    theta_int,                          // Theta (intermediate value, 16-bit fixed point).
                         __global int4*      state_theta,                        // Random number generator state.
                         __global int4*      state_threshold,                    // Random number generator state. 
-                        __global float*     spin_z_row_sum,                     // z-spin row summation.
-                        __global float*     spin_z2_row_sum,                    // z-spin square row summation.
-                        __global int*       m_overflow,                         // Rejection sampling overflow.
-                        __global int*       m_overflow_sum,                     // Rejection sampling overflow sum.
-                        __global float*     parameter)                          // Parameters.
+                        __global float*     spin_z_partial,                     // z-spin partial summation.
+                        __global float*     spin_z2_partial,                    // z-spin square partial summation.
+                        __global ushort*    m_overflow,                         // Rejection sampling iterations (16-bit counts).
+                        __global int*       m_overflow_partial,                 // Rejection sampling overflow partial summation.
+                        __global float*     parameter,                          // Parameters.
+                        __global float*     coupling,                           // Coupling table.
+                        __global int*       colour_node,                        // Nodes sorted by colour.
+                        __global int*       colour_offset,                      // Colour class offsets.
+                        __global float*     observable,                         // Observables (ring buffer).
+                        __global int*       step,                               // Step counter.
+                        __global int4*      replica,                            // Replica state (step, trial, status, decay).
+                        __global float*     energy_partial,                     // Energy partial summation.
+                        __global float*     temperature,                        // Replica temperature.
+                        __global int*       grid,                               // Structured grid (node of each grid cell, row by row).
+                        __global float*     spectrum,                           // Long-range field spectrum (sin(theta) transform, grid order).
+                        __global float*     coupling_spectrum,                  // Long-range coupling spectrum (scaled transform of J).
+                        __global float*     long_range,                         // Long-range field (node order).
+                        __global float*     halo,                               // Halo values (boundary, then ghost theta).
+                        __global int*       halo_node,                          // Boundary nodes (slice indices).
+                        __global float*     iteration_partial)                  // Rejection sampling iterations partial summation.
 { 
   ////////////////////////////////////////////////////////////////////////////////
   //////////////////////////////////// INDICES ///////////////////////////////////
@@ -43,32 +36,28 @@ __kernel void thekernel(__global float4*    color,
   uint         j_min = 0;                                                       // Neighbour stride minimun index.
   uint         j_max = offset[i];                                               // Neighbour stride maximum index.
   uint         k = 0;                                                           // Neighbour tuple index.
-  uint         n = central[j_max - 1];                                          // Node index.    
+  uint         n = SB_FIRST + i;                                                // Node index (global, Philox counter).
   uint         m = 0;                                                           // Rejection index.           
+  uint         q = get_global_id(1);                                            // Replica index [#].
+  uint         u = q*SB_NODES + i;                                              // Replica node index (the node is the slice row).
   
   ////////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////// CELL VARIABLES //////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////
-  float4       c                 = color[n];                                    // Node color.
-  float4       p                 = position[n];                                 // Central node position.
-  uint4        st_theta          = convert_uint4(state_theta[n]);               // Random generator state.
-  uint4        st_threshold      = convert_uint4(state_threshold[n]);           // Random generator state.
-  float        alpha             = parameter[0];                                // Radial exponent parameter...
-  float        T                 = parameter[1];                                // Temperature parameter...
+  generator    rng;                                                             // Random generator.
+  float        T                 = temperature[q];                              // Replica temperature...
   float        Hx                = parameter[2];                                // Longitudinal magnetic field parameter...
   float        Hz                = parameter[3];                                // Transverse magnetic field parameter...
-  uint         m_max             = (uint)parameter[4];                          // Maximum allowed number of rejections parameter...
-  uint         columns           = (uint)parameter[5];                          // Number of mesh columns parameter...
-  float        ds                = parameter[6];                                // Simulation spatial step parameter [m].
+  uint         m_max             = SB_M_MAX;                                    // Maximum allowed number of rejections parameter...
+  uint         sampler           = SB_SAMPLER;                                  // Single-site sampler parameter...
   float        dt                = parameter[7];                                // Simulation time step parameter [s].
-  float4       node              = (float4)(0.0f, 0.0f, 0.0f, 1.0f);            // Neighbour node position.
-  float2       link              = (float2)(0.0f, 0.0f);                        // Neighbour link.
-  float        L                 = 0.0f;                                        // Neighbour link length.
-  float        E                 = 0.0f;                                        // Energy function.
-  float        En                = 0.0f;                                        // Energy of central node.
-  float        theta_rand        = 0.0f;                                        // Flat random theta.
-  float        threshold_rand    = 0.0f;                                        // Flat random threshold.
-  float        D                 = 0.0f;                                        // Distributed random z-spin.
+  float        h                 = 0.0f;                                        // Neighbour local field.
+
+  // SKIPPING REPLICAS NOT RUNNING A TRIAL:
+  if (replica[q].z != REPLICA_RUNNING)
+  {
+    return;
+  }
  
   // COMPUTING STRIDE MINIMUM INDEX:
   if (i == 0)
@@ -80,54 +69,39 @@ __kernel void thekernel(__global float4*    color,
     j_min = offset[i - 1];                                                      // Setting stride minimum (all others)...
   }
 
-  // COMPUTING RANDOM Z-SPIN FROM DISTRIBUTION (rejection sampling):
-  do
-  {
-    theta_rand = uint_to_float(xoshiro128pp(&st_theta), 0.0f, 2.0f*M_PI_F);     // Generating random theta (flat distribution)...
-    threshold_rand = uint_to_float(xoshiro128pp(&st_threshold), 0.0f, +1.0f);   // Generating random threshold (flat distribution)...
-    En = E_central(Hx, Hz, theta[n]);                                           // Computing central energy term on central theta...
-    E = E_central(Hx, Hz, theta_rand);                                          // Computing central energy term on random theta...
-
-    // COMPUTING ENERGY:
-    for (j = j_min; j < j_max; j++)
-    {
-      k = neighbour[j];                                                         // Computing neighbour index...
-      node = position[k];                                                       // Getting neighbour position...
-      link = node.xy - p.xy;                                                    // Getting neighbour link vector...
-      L = length(link);                                                         // Computing neighbour link length...
-
-      if (L == (2.0f + ds))
-      {
-        L = ds;
-      }
+  // SETTING RANDOM GENERATOR (Philox: counter from node, sweep and trial, key from seed and replica):
+  rng.mode = SB_RNG;                                                            // Setting random generator mode...
 
-      if (L > (2.0f + ds))
-      {
-        L = sqrt(2.0f)*ds;
-      }
-      
-      En += E_neighbour(0.5f/pow(L/ds, alpha), theta[k], theta[n]);             // Accumulating neighbour energy terms on central z-spin...
-      E += E_neighbour(0.5f/pow(L/ds, alpha), theta[k], theta_rand);            // Accumulating neighbour energy terms on random z-spin...          
-    }
-    
-    D = 1.0f/(1.0f + exp((E - En)/T));                                          // Computing new z-spin candidate from distribution...
-    m++;                                                                        // Updating rejection index...
+  if (rng.mode == RNG_PHILOX)
+  {
+    rng.counter = (uint4)(n, (uint)replica[q].x, (uint)replica[q].y, 0);        // Setting Philox counter...
+    rng.key = (uint2)((uint)parameter[14] | ((uint)parameter[15] << 16), q);    // Setting Philox key...
+  }
+  else
+  {
+    rng.st_theta = convert_uint4(state_theta[u]);                               // Loading random generator state...
+    rng.st_threshold = convert_uint4(state_threshold[u]);                       // Loading random generator state...
   }
-  while ((threshold_rand > D) && (m < m_max));                                  // Evaluating new z-spin candidate (discarding if not found before m_max iterations)...
 
-  // EVALUATING REJECTION SAMPLING RESULT:
-  if(m < m_max)
+  // COMPUTING NEW THETA (intermediate value, from the current theta of all neighbours):
+  if (SB_LONG_RANGE)
   {
-    theta_int[n] = theta_rand;                                                  // Setting new theta (intermediate value)...
-    m_overflow[n] = 0;                                                          // Resetting rejection sampling overflow...
+    h = long_range[u];                                                          // Getting long-range field (all nodes, see long_range.hpp)...
   }
   else
   {
-    theta_int[n] = theta[n];                                                    // Keeping current theta (intermediate value)...
-    m_overflow[n] = 1;                                                          // Setting rejection sampling overflow...
+    h = local_field(neighbour, coupling, theta + (u - i), i, SB_NODES, SB_COMPACT,
+                    j_min, j_max);                                              // Computing neighbour local field (replica slice)...
   }
 
-  theta_int[n] = theta_rand;                                                    // Setting new z-spin (intermediate value)...
-  state_theta[n] = convert_int4(st_theta);                                      // Updating random generator state...
-  state_threshold[n] = convert_int4(st_threshold);                              // Updating random generator state...
+  theta_int[u] = angle_encode(sample_theta(sampler, angle_decode(theta[u]), h, T, Hx,
+                                            Hz, m_max, &rng, &m));              // Sampling new theta (intermediate value)...
+  m_overflow[u] = (ushort)m;                                                    // Setting rejection sampling iterations (m_max = overflow)...
+
+  // UPDATING RANDOM GENERATOR STATE (xoshiro128++ only):
+  if (rng.mode == RNG_XOSHIRO)
+  {
+    state_theta[u] = convert_int4(rng.st_theta);                                // Updating random generator state...
+    state_threshold[u] = convert_int4(rng.st_threshold);                        // Updating random generator state...
+  }
 }
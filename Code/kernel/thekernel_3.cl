@@ -1,40 +1,163 @@
 /// @file
+#define REDUCTION_SIZE 256                                                      // Local memory reduction size (work-group chunk).
 
-__kernel void thekernel(__global float4*    color,                              // Color.
-                        __global float4*    position,                           // Position.
-                        __global int*       central,                            // Node.
+__kernel void thekernel(__global float4*    position,                           // Position.
                         __global int*       neighbour,                          // Neighbour.
                         __global int*       offset,                             // Offset. 
-                        __global float*     theta,                              // Theta.  
-                        __global float*     theta_int,                          // Theta (intermediate value). 
+                        __global ushort*    theta,                              // Theta (16-bit fixed point, see angle.cl).
+                        __global ushort*    theta_int,                          // Theta (intermediate value, 16-bit fixed point).
                         __global int4*      state_theta,                        // Random number generator state.
                         __global int4*      state_threshold,                    // Random number generator state. 
-                        __global float*     spin_z_row_sum,                     // z-spin row summation.
-                        __global float*     spin_z2_row_sum,                    // z-spin square row summation.
-                        __global int*       m_overflow,                         // Rejection sampling overflow.
-                        __global int*       m_overflow_sum,                     // Rejection sampling overflow sum.
-                        __global float*     parameter)                          // Parameters.
+                        __global float*     spin_z_partial,                     // z-spin partial summation.
+                        __global float*     spin_z2_partial,                    // z-spin square partial summation.
+                        __global ushort*    m_overflow,                         // Rejection sampling iterations (16-bit counts).
+                        __global int*       m_overflow_partial,                 // Rejection sampling overflow partial summation.
+                        __global float*     parameter,                          // Parameters.
+                        __global float*     coupling,                           // Coupling table.
+                        __global int*       colour_node,                        // Nodes sorted by colour.
+                        __global int*       colour_offset,                      // Colour class offsets.
+                        __global float*     observable,                         // Observables (ring buffer).
+                        __global int*       step,                               // Step counter.
+                        __global int4*      replica,                            // Replica state (step, trial, status, decay).
+                        __global float*     energy_partial,                     // Energy partial summation.
+                        __global float*     temperature,                        // Replica temperature.
+                        __global int*       grid,                               // Structured grid (node of each grid cell, row by row).
+                        __global float*     spectrum,                           // Long-range field spectrum (sin(theta) transform, grid order).
+                        __global float*     coupling_spectrum,                  // Long-range coupling spectrum (scaled transform of J).
+                        __global float*     long_range,                         // Long-range field (node order).
+                        __global float*     halo,                               // Halo values (boundary, then ghost theta).
+                        __global int*       halo_node,                          // Boundary nodes (slice indices).
+                        __global float*     iteration_partial)                  // Rejection sampling iterations partial summation.
 {
   ////////////////////////////////////////////////////////////////////////////////
   //////////////////////////////////// INDICES ///////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////
   uint         i = get_global_id(0);                                            // Global index [#].
-  uint         j = 0;                                                           // Row stride index.
-  uint         j_min = i*(uint)parameter[5];                                    // Row stride minimum index (based on number of columns).
-  uint         j_max = (i + 1)*(uint)parameter[5] - 1;                          // Row stride maximum index (based on number of columns).
+  uint         l = get_local_id(0);                                             // Local index [#].
+  uint         l_size = get_local_size(0);                                      // Work-group size [#].
+  uint         q = get_global_id(1);                                            // Replica index [#].
+  uint         row = 0;                                                         // Work-group replica row index [#].
+  uint         r = 0;                                                           // CSR row index.
+  uint         j_min = 0;                                                       // Neighbour stride minimun index.
+  uint         j_max = 0;                                                       // Neighbour stride maximum index.
+  uint         nodes = SB_NODES;                                                // Number of nodes parameter...
+  uint         rows = SB_ROWS;                                                  // Number of CSR rows parameter...
+  int          m_max = (int)SB_M_MAX;                                           // Maximum allowed number of rejections parameter...
+  uint         groups = SB_GROUPS;                                              // Number of partial summations parameter...
+  uint         base = 0;                                                        // Work-group chunk base index.
+  uint         count = 0;                                                       // Work-group chunk size.
+  uint         s = 0;                                                           // Tree reduction stride.
+  bool         active = false;                                                  // Active work-item flag (current row and chunk).
+  float        Hx = parameter[2];                                               // Longitudinal magnetic field parameter...
+  float        Hz = parameter[3];                                               // Transverse magnetic field parameter...
+  float        th = 0.0f;                                                       // Theta.
+  float        sz = 0.0f;                                                       // z-spin.
+  float        h = 0.0f;                                                        // Neighbour local field.
   float        spin_z_partial_sum = 0.0f;                                       // z_spin partial summation.
   float        spin_z2_partial_sum = 0.0f;                                      // z_spin square partial summation.
   int          m_overflow_partial_sum = 0;                                      // Rejection sampling overflow partial summation.
+  float        energy_partial_sum = 0.0f;                                       // Energy partial summation.
+  float        iteration_partial_sum = 0.0f;                                    // Rejection sampling iterations partial summation.
+  float        spin_z_group_sum = 0.0f;                                         // z_spin work-group summation.
+  float        spin_z2_group_sum = 0.0f;                                        // z_spin square work-group summation.
+  int          m_overflow_group_sum = 0;                                        // Rejection sampling overflow work-group summation.
+  float        energy_group_sum = 0.0f;                                         // Energy work-group summation.
+  float        iteration_group_sum = 0.0f;                                      // Rejection sampling iterations work-group summation.
 
-  // Summating all z-spin in a row:
-  for (j = j_min; j < j_max; j++)
+  __local float spin_z_local[REDUCTION_SIZE];                                   // z_spin local summation.
+  __local float spin_z2_local[REDUCTION_SIZE];                                  // z_spin square local summation.
+  __local int   m_overflow_local[REDUCTION_SIZE];                               // Rejection sampling overflow local summation.
+  __local float energy_local[REDUCTION_SIZE];                                   // Energy local summation.
+  __local float iteration_local[REDUCTION_SIZE];                                // Rejection sampling iterations local summation.
+
+  // Updating step counter and number of work-groups (read by the next kernel, the runtime sets the local size):
+  if ((i == 0) && (q == 0))
   {
-    spin_z_partial_sum += sin(theta[j]);                                        // Accumulating z-spin partial summation...
-    spin_z2_partial_sum += pown(sin(theta[j]), 2);                              // Accumulating z-spin square partial summation...
-    m_overflow_partial_sum += m_overflow[j];                                    // Accumulating rejection sampling partial overflows...
+    step[0]++;                                                                  // Updating step counter...
+    step[1] = (int)get_num_groups(0);                                           // Setting number of partial summations written...
   }
 
-  spin_z_row_sum[i] = spin_z_partial_sum;                                       // Setting z-spin row summation...
-  spin_z2_row_sum[i] = spin_z2_partial_sum;                                     // Setting z-spin square row summation...
-  m_overflow_sum[i] = m_overflow_partial_sum;                                   // Setting rejection sampling overflow row summation...
+  // Summating all z-spin of the work-item (grid-stride over the CSR rows of the replica slice):
+  for (r = i; r < rows; r += get_global_size(0))
+  {
+    j_min = (r == 0) ? 0 : offset[r - 1];                                       // Setting stride minimum...
+    j_max = offset[r];                                                          // Setting stride maximum...
+    th = angle_decode(theta[q*nodes + r]);                                      // Getting theta...
+    sz = sin(th);                                                               // Computing z-spin...
+    spin_z_partial_sum += sz;                                                   // Accumulating z-spin partial summation...
+    spin_z2_partial_sum += sz*sz;                                               // Accumulating z-spin square partial summation...
+    m_overflow_partial_sum += (m_overflow[q*nodes + r] >= m_max) ? 1 : 0;       // Accumulating rejection sampling partial overflows...
+    iteration_partial_sum += (float)m_overflow[q*nodes + r];                    // Accumulating rejection sampling partial iterations...
+
+    // Accumulating energy (only when the host consumes it: the local field is a second CSR pass):
+    if (SB_ENERGY)
+    {
+      if (SB_LONG_RANGE)
+      {
+        h = long_range[q*nodes + r];                                            // Getting long-range field (all nodes, see long_range.hpp)...
+      }
+      else
+      {
+        h = local_field(neighbour, coupling, theta + q*nodes, r, nodes, SB_COMPACT,
+                        j_min, j_max);                                          // Computing neighbour local field (replica slice)...
+      }
+
+      energy_partial_sum += E_central(Hx, Hz + 0.5f*h, th);                     // Accumulating energy (each pair counted once)...
+    }
+  }
+
+  // Summating all work-items of the work-group (tree reduction, one replica row and REDUCTION_SIZE items at a time):
+  for (row = 0; row < get_local_size(1); row++)
+  {
+    for (base = 0; base < l_size; base += REDUCTION_SIZE)
+    {
+      count = min(l_size - base, (uint)REDUCTION_SIZE);                         // Computing chunk size...
+      active = (get_local_id(1) == row) && (l >= base) && ((l - base) < count); // Checking work-item...
+
+      if (active)
+      {
+        spin_z_local[l - base] = spin_z_partial_sum;                            // Storing z-spin partial summation...
+        spin_z2_local[l - base] = spin_z2_partial_sum;                          // Storing z-spin square partial summation...
+        m_overflow_local[l - base] = m_overflow_partial_sum;                    // Storing rejection sampling partial overflows...
+        energy_local[l - base] = energy_partial_sum;                            // Storing energy partial summation...
+        iteration_local[l - base] = iteration_partial_sum;                      // Storing rejection sampling partial iterations...
+      }
+
+      barrier(CLK_LOCAL_MEM_FENCE);                                             // Synchronizing work-group...
+
+      for (s = REDUCTION_SIZE/2; s > 0; s >>= 1)
+      {
+        if (active && ((l - base) < s) && ((l - base + s) < count))
+        {
+          spin_z_local[l - base] += spin_z_local[l - base + s];                 // Reducing z-spin...
+          spin_z2_local[l - base] += spin_z2_local[l - base + s];               // Reducing z-spin square...
+          m_overflow_local[l - base] += m_overflow_local[l - base + s];         // Reducing rejection sampling overflows...
+          energy_local[l - base] += energy_local[l - base + s];                 // Reducing energy...
+          iteration_local[l - base] += iteration_local[l - base + s];           // Reducing rejection sampling iterations...
+        }
+
+        barrier(CLK_LOCAL_MEM_FENCE);                                           // Synchronizing work-group...
+      }
+
+      if (get_local_id(1) == row)
+      {
+        spin_z_group_sum += spin_z_local[0];                                    // Accumulating z-spin work-group summation...
+        spin_z2_group_sum += spin_z2_local[0];                                  // Accumulating z-spin square work-group summation...
+        m_overflow_group_sum += m_overflow_local[0];                            // Accumulating rejection sampling work-group overflows...
+        energy_group_sum += energy_local[0];                                    // Accumulating energy work-group summation...
+        iteration_group_sum += iteration_local[0];                              // Accumulating rejection sampling work-group iterations...
+      }
+
+      barrier(CLK_LOCAL_MEM_FENCE);                                             // Synchronizing work-group...
+    }
+  }
+
+  if (l == 0)
+  {
+    spin_z_partial[q*groups + get_group_id(0)] = spin_z_group_sum;              // Setting z-spin work-group summation...
+    spin_z2_partial[q*groups + get_group_id(0)] = spin_z2_group_sum;            // Setting z-spin square work-group summation...
+    m_overflow_partial[q*groups + get_group_id(0)] = m_overflow_group_sum;      // Setting rejection sampling work-group overflows...
+    energy_partial[q*groups + get_group_id(0)] = energy_group_sum;              // Setting energy work-group summation...
+    iteration_partial[q*groups + get_group_id(0)] = iteration_group_sum;        // Setting rejection sampling work-group iterations...
+  }
 }
\ No newline at end of file
@@ -0,0 +1,103 @@
+/// @file
+
+__kernel void thekernel(__global float4*    position,                           // Position.
+                        __global int*       neighbour,                          // Neighbour.
+                        __global int*       offset,                             // Offset. 
+                        __global ushort*    theta,                              // Theta (16-bit fixed point, see angle.cl).
+                        __global ushort*    theta_int,                          // Theta (intermediate value, 16-bit fixed point).
+                        __global int4*      state_theta,                        // Random number generator state.
+                        __global int4*      state_threshold,                    // Random number generator state. 
+                        __global float*     spin_z_partial,                     // z-spin partial summation.
+                        __global float*     spin_z2_partial,                    // z-spin square partial summation.
+                        __global ushort*    m_overflow,                         // Rejection sampling iterations (16-bit counts).
+                        __global int*       m_overflow_partial,                 // Rejection sampling overflow partial summation.
+                        __global float*     parameter,                          // Parameters.
+                        __global float*     coupling,                           // Coupling table.
+                        __global int*       colour_node,                        // Nodes sorted by colour.
+                        __global int*       colour_offset,                      // Colour class offsets.
+                        __global float*     observable,                         // Observables (ring buffer).
+                        __global int*       step,                               // Step counter.
+                        __global int4*      replica,                            // Replica state (step, trial, status, decay).
+                        __global float*     energy_partial,                     // Energy partial summation.
+                        __global float*     temperature,                        // Replica temperature.
+                        __global int*       grid,                               // Structured grid (node of each grid cell, row by row).
+                        __global float*     spectrum,                           // Long-range field spectrum (sin(theta) transform, grid order).
+                        __global float*     coupling_spectrum,                  // Long-range coupling spectrum (scaled transform of J).
+                        __global float*     long_range,                         // Long-range field (node order).
+                        __global float*     halo,                               // Halo values (boundary, then ghost theta).
+                        __global int*       halo_node,                          // Boundary nodes (slice indices).
+                        __global float*     iteration_partial)                  // Rejection sampling iterations partial summation.
+{ 
+  ////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////// INDICES ///////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////
+  uint         i = get_global_id(0);                                            // Global index (within colour class) [#].
+  uint         c = SB_COLOUR;                                                   // Colour class index (build option, one kernel per class) [#].
+  uint         c_min = (c == 0) ? 0 : colour_offset[c - 1];                     // Colour class minimum index.
+  uint         c_max = colour_offset[c];                                        // Colour class maximum index.
+  uint         n = 0;                                                           // Node index.
+  uint         j_min = 0;                                                       // Neighbour stride minimun index.
+  uint         j_max = 0;                                                       // Neighbour stride maximum index.
+  uint         m = 0;                                                           // Rejection index.
+  uint         q = get_global_id(1);                                            // Replica index [#].
+  uint         u = 0;                                                           // Replica node index.
+
+  // SKIPPING WORK-ITEMS BEYOND THE COLOUR CLASS:
+  if (((c_min + i) >= c_max) || (replica[q].z != REPLICA_RUNNING))
+  {
+    return;
+  }
+
+  n = colour_node[c_min + i];                                                   // Getting node index...
+  j_min = (n == 0) ? 0 : offset[n - 1];                                         // Setting stride minimum...
+  j_max = offset[n];                                                            // Setting stride maximum...
+  u = q*SB_NODES + n;                                                           // Setting replica node index...
+
+  ////////////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////// CELL VARIABLES //////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////
+  generator    rng;                                                             // Random generator.
+  float        T                 = temperature[q];                              // Replica temperature...
+  float        Hx                = parameter[2];                                // Longitudinal magnetic field parameter...
+  float        Hz                = parameter[3];                                // Transverse magnetic field parameter...
+  uint         m_max             = SB_M_MAX;                                    // Maximum allowed number of rejections parameter...
+  uint         sampler           = SB_SAMPLER;                                  // Single-site sampler parameter...
+  float        h                 = 0.0f;                                        // Neighbour local field.
+
+  // SETTING RANDOM GENERATOR (Philox: counter from node, sweep and trial, key from seed and replica):
+  rng.mode = SB_RNG;                                                            // Setting random generator mode...
+
+  if (rng.mode == RNG_PHILOX)
+  {
+    rng.counter = (uint4)(n, (uint)replica[q].x, (uint)replica[q].y, 0);        // Setting Philox counter...
+    rng.key = (uint2)((uint)parameter[14] | ((uint)parameter[15] << 16), q);    // Setting Philox key...
+  }
+  else
+  {
+    rng.st_theta = convert_uint4(state_theta[u]);                               // Loading random generator state...
+    rng.st_threshold = convert_uint4(state_threshold[u]);                       // Loading random generator state...
+  }
+
+  // COMPUTING NEW THETA (in place: neighbours have other colours and are not being updated):
+  if (SB_LONG_RANGE)
+  {
+    h = long_range[u];                                                          // Getting long-range field (all nodes, see long_range.hpp)...
+  }
+  else
+  {
+    h = local_field(neighbour, coupling, theta + (u - n), n, SB_NODES, SB_COMPACT,
+                    j_min, j_max);                                              // Computing neighbour local field (replica slice)...
+  }
+
+  theta[u] = angle_encode(sample_theta(sampler, angle_decode(theta[u]), h, T, Hx, Hz,
+                                        m_max, &rng, &m));                      // Sampling new theta...
+  theta_int[u] = theta[u];                                                      // Keeping intermediate value coherent (for K2)...
+  m_overflow[u] = (ushort)m;                                                    // Setting rejection sampling iterations (m_max = overflow)...
+
+  // UPDATING RANDOM GENERATOR STATE (xoshiro128++ only):
+  if (rng.mode == RNG_XOSHIRO)
+  {
+    state_theta[u] = convert_int4(rng.st_theta);                                // Updating random generator state...
+    state_threshold[u] = convert_int4(rng.st_threshold);                        // Updating random generator state...
+  }
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+/// @file
+
+__kernel void thekernel(__global float4*    position,                           // Position.
+                        __global int*       neighbour,                          // Neighbour.
+                        __global int*       offset,                             // Offset. 
+                        __global ushort*    theta,                              // Theta (16-bit fixed point, see angle.cl).
+                        __global ushort*    theta_int,                          // Theta (intermediate value, 16-bit fixed point).
+                        __global int4*      state_theta,                        // Random number generator state.
+                        __global int4*      state_threshold,                    // Random number generator state. 
+                        __global float*     spin_z_partial,                     // z-spin partial summation.
+                        __global float*     spin_z2_partial,                    // z-spin square partial summation.
+                        __global ushort*    m_overflow,                         // Rejection sampling iterations (16-bit counts).
+                        __global int*       m_overflow_partial,                 // Rejection sampling overflow partial summation.
+                        __global float*     parameter,                          // Parameters.
+                        __global float*     coupling,                           // Coupling table.
+                        __global int*       colour_node,                        // Nodes sorted by colour.
+                        __global int*       colour_offset,                      // Colour class offsets.
+                        __global float*     observable,                         // Observables (ring buffer).
+                        __global int*       step,                               // Step counter.
+                        __global int4*      replica,                            // Replica state (step, trial, status, decay).
+                        __global float*     energy_partial,                     // Energy partial summation.
+                        __global float*     temperature,                        // Replica temperature.
+                        __global int*       grid,                               // Structured grid (node of each grid cell, row by row).
+                        __global float*     spectrum,                           // Long-range field spectrum (sin(theta) transform, grid order).
+                        __global float*     coupling_spectrum,                  // Long-range coupling spectrum (scaled transform of J).
+                        __global float*     long_range,                         // Long-range field (node order).
+                        __global float*     halo,                               // Halo values (boundary, then ghost theta).
+                        __global int*       halo_node,                          // Boundary nodes (slice indices).
+                        __global float*     iteration_partial)                  // Rejection sampling iterations partial summation.
+{
+  ////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////// INDICES ///////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////
+  uint         g = 0;                                                           // Work-group index [#].
+  uint         q = get_global_id(0);                                            // Replica index [#].
+  uint         replicas = SB_REPLICAS;                                          // Number of replicas parameter...
+  uint         groups = SB_GROUPS;                                              // Partial summation slots per replica parameter...
+  uint         written = (uint)step[1];                                         // Partial summations written by K3 (its work-groups).
+  uint         depth = SB_DEPTH;                                                // Observable ring depth parameter...
+  uint         length = (uint)parameter[12];                                    // Trial length parameter (0 = unlimited)...
+  uint         nodes = SB_NODES;                                                // Number of nodes parameter...
+  float        decay_sz = parameter[21];                                        // Decay threshold on <sz> parameter...
+  uint         decay = (uint)parameter[22];                                     // Decay detection parameter (0 = off)...
+  int          side = DECAY_UNKNOWN;                                            // Side of the decay threshold.
+  uint         slot = ((uint)step[0] - 1) % depth;                              // Observable ring slot (step counter updated by K3).
+  uint         base = (slot*replicas + q)*OBSERVABLES;                          // Observable base index.
+  int4         rep = replica[q];                                                // Replica state.
+  float        spin_z_sum = 0.0f;                                               // z_spin summation.
+  float        spin_z2_sum = 0.0f;                                              // z_spin square summation.
+  int          m_overflow_sum = 0;                                              // Rejection sampling overflow summation.
+  float        energy_sum = 0.0f;                                               // Energy summation.
+  float        iteration_sum = 0.0f;                                            // Rejection sampling iterations summation.
+
+  // Summating all work-group partial summations of the replica (one work-item per replica):
+  for (g = 0; g < written; g++)
+  {
+    spin_z_sum += spin_z_partial[q*groups + g];                                 // Accumulating z-spin summation...
+    spin_z2_sum += spin_z2_partial[q*groups + g];                               // Accumulating z-spin square summation...
+    m_overflow_sum += m_overflow_partial[q*groups + g];                         // Accumulating rejection sampling overflows...
+    energy_sum += energy_partial[q*groups + g];                                 // Accumulating energy...
+    iteration_sum += iteration_partial[q*groups + g];                           // Accumulating rejection sampling iterations...
+  }
+
+  // Advancing replica trial:
+  if (rep.z == REPLICA_RUNNING)
+  {
+    rep.x++;                                                                    // Updating replica trial step...
+
+    // DETECTING DECAY (<sz> crossing the threshold, from the side of the first step):
+    if (decay != 0)
+    {
+      side = (spin_z_sum/nodes > decay_sz) ? DECAY_ABOVE : DECAY_BELOW;         // Getting threshold side...
+
+      if (rep.w == DECAY_UNKNOWN)
+      {
+        rep.w = side;                                                           // Setting starting side...
+      }
+      else if (rep.w != side)
+      {
+        rep.w = DECAY_EVENT;                                                    // Flagging decay (rep.x = decay step)...
+        rep.z = REPLICA_DONE;                                                   // Terminating replica trial...
+      }
+    }
+
+    if ((length > 0) && ((uint)rep.x >= length))
+    {
+      rep.z = REPLICA_DONE;                                                     // Terminating replica trial...
+    }
+
+    observable[base + OBS_STEP] = (float)rep.x;                                 // Setting replica trial step...
+  }
+  else
+  {
+    observable[base + OBS_STEP] = 0.0f;                                         // Setting replica trial step (not running)...
+  }
+
+  observable[base + OBS_SZ] = spin_z_sum;                                       // Setting z-spin summation...
+  observable[base + OBS_SZ2] = spin_z2_sum;                                     // Setting z-spin square summation...
+  observable[base + OBS_OVERFLOW] = (float)m_overflow_sum;                      // Setting rejection sampling overflow summation...
+  observable[base + OBS_ENERGY] = energy_sum;                                   // Setting energy summation...
+  observable[base + OBS_ITERATIONS] = iteration_sum;                            // Setting rejection sampling iterations summation...
+  replica[q] = rep;                                                             // Updating replica state...
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+/// @file
+#define TILE_SIZE  16                                                           // Work-group side (global sizes rounded up to it).
+#define TILE_ITEMS 324                                                          // Local memory tile size (16 x 16 work-items plus halo).
+
+// Fixed 16 x 16 x 1 work-group (matching TILE_ITEMS): every work-group takes the tiled path.
+__attribute__((reqd_work_group_size(TILE_SIZE, TILE_SIZE, 1)))
+__kernel void thekernel(__global float4*    position,                           // Position.
+                        __global int*       neighbour,                          // Neighbour.
+                        __global int*       offset,                             // Offset. 
+                        __global ushort*    theta,                              // Theta (16-bit fixed point, see angle.cl).
+                        __global ushort*    theta_int,                          // Theta (intermediate value, 16-bit fixed point).
+                        __global int4*      state_theta,                        // Random number generator state.
+                        __global int4*      state_threshold,                    // Random number generator state. 
+                        __global float*     spin_z_partial,                     // z-spin partial summation.
+                        __global float*     spin_z2_partial,                    // z-spin square partial summation.
+                        __global ushort*    m_overflow,                         // Rejection sampling iterations (16-bit counts).
+                        __global int*       m_overflow_partial,                 // Rejection sampling overflow partial summation.
+                        __global float*     parameter,                          // Parameters.
+                        __global float*     coupling,                           // Coupling table.
+                        __global int*       colour_node,                        // Nodes sorted by colour.
+                        __global int*       colour_offset,                      // Colour class offsets.
+                        __global float*     observable,                         // Observables (ring buffer).
+                        __global int*       step,                               // Step counter.
+                        __global int4*      replica,                            // Replica state (step, trial, status, decay).
+                        __global float*     energy_partial,                     // Energy partial summation.
+                        __global float*     temperature,                        // Replica temperature.
+                        __global int*       grid,                               // Structured grid (node of each grid cell, row by row).
+                        __global float*     spectrum,                           // Long-range field spectrum (sin(theta) transform, grid order).
+                        __global float*     coupling_spectrum,                  // Long-range coupling spectrum (scaled transform of J).
+                        __global float*     long_range,                         // Long-range field (node order).
+                        __global float*     halo,                               // Halo values (boundary, then ghost theta).
+                        __global int*       halo_node,                          // Boundary nodes (slice indices).
+                        __global float*     iteration_partial)                  // Rejection sampling iterations partial summation.
+{ 
+  ////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////// INDICES ///////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////
+  uint         x = get_global_id(0);                                            // Grid column index [#].
+  uint         y = get_global_id(1);                                            // Grid row index [#].
+  uint         q = get_global_id(2);                                            // Replica index [#].
+  uint         nodes = SB_NODES;                                                // Number of nodes parameter...
+  uint         nx = SB_COLUMNS;                                                 // Grid columns parameter...
+  uint         ny = SB_GRID_ROWS;                                               // Grid rows parameter...
+  uint         stencil = SB_STENCIL;                                            // Grid stencil parameter (4 or 8 neighbours)...
+  uint         tx = TILE_SIZE + 2;                                              // Tile columns (with halo) [#].
+  uint         ty = TILE_SIZE + 2;                                              // Tile rows (with halo) [#].
+  uint         lx = get_local_id(0) + 1;                                        // Tile column index [#].
+  uint         ly = get_local_id(1) + 1;                                        // Tile row index [#].
+  uint         t = 0;                                                           // Tile index.
+  uint         cx = 0;                                                          // Tile cell grid column index [#].
+  uint         cy = 0;                                                          // Tile cell grid row index [#].
+  bool         active = (x < nx) && (y < ny);                                   // In-grid flag (edge work-groups overhang the grid).
+  uint         n = active ? grid[y*nx + x] : 0;                                 // Node index.
+  uint         m = 0;                                                           // Rejection index.
+  uint         u = q*nodes + n;                                                 // Replica node index.
+  
+  ////////////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////// CELL VARIABLES //////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////
+  __local float tile[TILE_ITEMS];                                               // Tile of sin(theta) (work-group plus halo).
+  __global ushort* slice = theta + q*nodes;                                     // Replica theta slice.
+  generator    rng;                                                             // Random generator.
+  float        T                 = temperature[q];                              // Replica temperature...
+  float        Hx                = parameter[2];                                // Longitudinal magnetic field parameter...
+  float        Hz                = parameter[3];                                // Transverse magnetic field parameter...
+  uint         m_max             = SB_M_MAX;                                    // Maximum allowed number of rejections parameter...
+  uint         sampler           = SB_SAMPLER;                                  // Single-site sampler parameter...
+  float        C_axial           = coupling[grid[nx*ny]];                       // Axial coupling (reference edge).
+  float        C_diagonal        = coupling[grid[nx*ny + 1]];                   // Diagonal coupling (reference edge).
+  float        h_axial           = 0.0f;                                        // Axial neighbour summation.
+  float        h_diagonal        = 0.0f;                                        // Diagonal neighbour summation.
+  float        h                 = 0.0f;                                        // Neighbour local field.
+
+  // LOADING TILE (sin(theta) of the work-group cells and of their halo, periodic; overhanging
+  // work-items load their share and reach the barrier too):
+  for (t = get_local_id(1)*TILE_SIZE + get_local_id(0); t < tx*ty; t += TILE_SIZE*TILE_SIZE)
+  {
+    cx = (get_group_id(0)*TILE_SIZE + t%tx + nx - 1)%nx;                        // Computing tile cell column (periodic)...
+    cy = (get_group_id(1)*TILE_SIZE + t/tx + ny - 1)%ny;                        // Computing tile cell row (periodic)...
+    tile[t] = sin(angle_decode(slice[grid[cy*nx + cx]]));                       // Loading tile cell...
+  }
+
+  barrier(CLK_LOCAL_MEM_FENCE);                                                 // Waiting for the whole tile...
+
+  // SKIPPING CELLS OUTSIDE THE GRID AND REPLICAS NOT RUNNING A TRIAL (after the barrier):
+  if (!active || (replica[q].z != REPLICA_RUNNING))
+  {
+    return;
+  }
+
+  // COMPUTING NEIGHBOUR LOCAL FIELD (implicit stencil, from the tile):
+  h_axial = tile[ly*tx + lx + 1] + tile[ly*tx + lx - 1] +
+            tile[(ly + 1)*tx + lx] + tile[(ly - 1)*tx + lx];                    // Summating axial neighbours...
+
+  if (stencil == 8)
+  {
+    h_diagonal = tile[(ly + 1)*tx + lx + 1] + tile[(ly + 1)*tx + lx - 1] +
+                 tile[(ly - 1)*tx + lx + 1] + tile[(ly - 1)*tx + lx - 1];       // Summating diagonal neighbours...
+  }
+
+  h = C_axial*h_axial + C_diagonal*h_diagonal;                                  // Computing neighbour local field...
+
+  // SETTING RANDOM GENERATOR (Philox: counter from node, sweep and trial, key from seed and replica):
+  rng.mode = SB_RNG;                                                            // Setting random generator mode...
+
+  if (rng.mode == RNG_PHILOX)
+  {
+    rng.counter = (uint4)(n, (uint)replica[q].x, (uint)replica[q].y, 0);        // Setting Philox counter...
+    rng.key = (uint2)((uint)parameter[14] | ((uint)parameter[15] << 16), q);    // Setting Philox key...
+  }
+  else
+  {
+    rng.st_theta = convert_uint4(state_theta[u]);                               // Loading random generator state...
+    rng.st_threshold = convert_uint4(state_threshold[u]);                       // Loading random generator state...
+  }
+
+  // COMPUTING NEW THETA (intermediate value, from the current theta of all neighbours):
+  theta_int[u] = angle_encode(sample_theta(sampler, angle_decode(theta[u]), h, T, Hx,
+                                            Hz, m_max, &rng, &m));              // Sampling new theta (intermediate value)...
+  m_overflow[u] = (ushort)m;                                                    // Setting rejection sampling iterations (m_max = overflow)...
+
+  // UPDATING RANDOM GENERATOR STATE (xoshiro128++ only):
+  if (rng.mode == RNG_XOSHIRO)
+  {
+    state_theta[u] = convert_int4(rng.st_theta);                                // Updating random generator state...
+    state_threshold[u] = convert_int4(rng.st_threshold);                        // Updating random generator state...
+  }
+}
\ No newline at end of file
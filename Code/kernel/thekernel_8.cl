@@ -0,0 +1,59 @@
+/// @file
+
+__kernel void thekernel(__global float4*    position,                           // Position.
+                        __global int*       neighbour,                          // Neighbour.
+                        __global int*       offset,                             // Offset. 
+                        __global ushort*    theta,                              // Theta (16-bit fixed point, see angle.cl).
+                        __global ushort*    theta_int,                          // Theta (intermediate value, 16-bit fixed point).
+                        __global int4*      state_theta,                        // Random number generator state.
+                        __global int4*      state_threshold,                    // Random number generator state. 
+                        __global float*     spin_z_partial,                     // z-spin partial summation.
+                        __global float*     spin_z2_partial,                    // z-spin square partial summation.
+                        __global ushort*    m_overflow,                         // Rejection sampling iterations (16-bit counts).
+                        __global int*       m_overflow_partial,                 // Rejection sampling overflow partial summation.
+                        __global float*     parameter,                          // Parameters.
+                        __global float*     coupling,                           // Coupling table.
+                        __global int*       colour_node,                        // Nodes sorted by colour.
+                        __global int*       colour_offset,                      // Colour class offsets.
+                        __global float*     observable,                         // Observables (ring buffer).
+                        __global int*       step,                               // Step counter.
+                        __global int4*      replica,                            // Replica state (step, trial, status, decay).
+                        __global float*     energy_partial,                     // Energy partial summation.
+                        __global float*     temperature,                        // Replica temperature.
+                        __global int*       grid,                               // Structured grid (node of each grid cell, row by row).
+                        __global float*     spectrum,                           // Long-range field spectrum (sin(theta) transform, grid order).
+                        __global float*     coupling_spectrum,                  // Long-range coupling spectrum (scaled transform of J).
+                        __global float*     long_range,                         // Long-range field (node order).
+                        __global float*     halo,                               // Halo values (boundary, then ghost theta).
+                        __global int*       halo_node,                          // Boundary nodes (slice indices).
+                        __global float*     iteration_partial)                  // Rejection sampling iterations partial summation.
+{
+  ////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////// INDICES ///////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////
+  uint         x = get_global_id(0);                                            // Grid column index [#].
+  uint         q = get_global_id(1);                                            // Replica index [#].
+  uint         y = 0;                                                           // Grid row index [#].
+  uint         nx = SB_COLUMNS;                                                 // Grid columns parameter...
+  uint         ny = SB_GRID_ROWS;                                               // Grid rows parameter...
+  __global float* column = spectrum + 2*(q*ny*nx + x);                          // Spectrum column.
+
+  // SKIPPING REPLICAS NOT RUNNING A TRIAL:
+  if (replica[q].z != REPLICA_RUNNING)
+  {
+    return;
+  }
+
+  // TRANSFORMING COLUMN:
+  fft(column, ny, nx, -1.0f);                                                   // Computing forward FFT...
+
+  // CONVOLVING WITH THE COUPLING (product with its real, scaled spectrum):
+  for (y = 0; y < ny; y++)
+  {
+    column[2*y*nx] *= coupling_spectrum[y*nx + x];                              // Multiplying real part...
+    column[2*y*nx + 1] *= coupling_spectrum[y*nx + x];                          // Multiplying imaginary part...
+  }
+
+  // TRANSFORMING COLUMN BACK:
+  fft(column, ny, nx, +1.0f);                                                   // Computing inverse FFT...
+}
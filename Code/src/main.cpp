@@ -10,71 +10,23 @@
 #define PY            0.0f                                                                           // y-axis pan initial translation.
 #define PZ            -2.0f                                                                          // z-axis pan initial translation.
 
-#define SURFACE_TAG   1                                                                              // Surface tag.
-#define BORDER_TAG    9                                                                              // Border tag.
-#define SIDE_X_TAG    10                                                                             // Side "x" tag.
-#define SIDE_Y_TAG    11                                                                             // Side "y" tag.
-#define CURVE_DIM     1                                                                              // Curve dimension.
-#define SURFACE_DIM   2                                                                              // Surface dimension.
-#define BORDER_DIM    1                                                                              // Border dimension.
-#define SIDE_X_DIM    1                                                                              // Side "x" dimension.
-#define SIDE_Y_DIM    1                                                                              // Side "y" dimension.
-#define DS            0.05f                                                                          // vacuum elementary cell side.
-#define EPSILON       0.01f                                                                          // Tolerance for cell detection.
-#define CELL_VERTICES 4                                                                              // Number of vertices per elementary cell.
-
-#define M_MAX         1000                                                                           // Maximum allowed number of rejections.
-#define HX_INIT       0.8f                                                                           // Longitudinal magnetic field.
-#define HZ_INIT       0.01f                                                                          // Transverse magnetic field.
-#define T_INIT        0.1f                                                                           // Temperature.
-#define ALPHA_INIT    1.0f                                                                           // Radial exponent.
-#define THETA_INIT    M_PI                                                                           // Theta angle.
-#define TRIALS_INIT   100                                                                            // Auto-trials.
-#define DATA_POINTS   100                                                                            // Data points for energy profile.
-
-#ifdef __linux__
-  #define SHADER_HOME "../../Code/shader/"                                                           // Linux OpenGL shaders directory.
-  #define KERNEL_HOME "../../Code/kernel/"                                                           // Linux OpenCL kernels directory.
-  #define GMSH_HOME   "../../Code/mesh/"                                                             // Linux GMSH mesh directory.
-  #define LOG_HOME    "../../log/"                                                                   // Linux log directory.
-  #define DLOAD_HOME  "../../log/"                                                                   // Linux log directory.
-  #define ULOAD_HOME  "../../log/"                                                                   // Linux log directory.
-#endif
-
-#ifdef WIN32
-  #define SHADER_HOME "..\\..\\Code\\shader\\"                                                       // Windows OpenGL shaders directory.
-  #define KERNEL_HOME "..\\..\\Code\\kernel\\"                                                       // Windows OpenCL kernels directory.
-  #define GMSH_HOME   "..\\..\\Code\\mesh\\"                                                         // Windows GMSH mesh directory.
-  #define LOG_HOME    "..\\..\\log\\"                                                                // Windows log directory.
-  #define DLOAD_HOME  "..\\..\\log\\"                                                                // Windows log directory.
-  #define ULOAD_HOME  "..\\..\\log\\"                                                                // Windows log directory.
-#endif
-
 #define SHADER_VERT   "voxel_vertex.vert"                                                            // OpenGL vertex shader.
 #define SHADER_GEOM   "voxel_geometry.geom"                                                          // OpenGL geometry shader.
 #define SHADER_FRAG   "voxel_fragment.frag"                                                          // OpenGL fragment shader.
-#define KERNEL_0      "thekernel_0.cl"                                                               // OpenCL kernel source.
-#define KERNEL_1      "thekernel_1.cl"                                                               // OpenCL kernel source.
-#define KERNEL_2      "thekernel_2.cl"                                                               // OpenCL kernel source.
-#define KERNEL_3      "thekernel_3.cl"                                                               // OpenCL kernel source.
-#define UTILITIES     "utilities.cl"                                                                 // OpenCL utilities source.
-#define MESH_FILE     "Periodic_square.msh"                                                          // GMSH mesh.
-#define MESH          GMSH_HOME MESH_FILE                                                            // GMSH mesh (full path).
-#define LOG_FILE      "Data_"                                                                        // Log file name.
-#define LOG_HEAD      "Spin bubble."                                                                 // Log file header.
-#define LOG_EXT       "dat"                                                                          // Log file extension.
-#define LOG           LOG_HOME LOG_FILE                                                              // Log file name (full name, timestamp and extension to be added).
-#define DLOAD_FILE    "Download_"                                                                    // Download file name.
-#define DLOAD_HEAD    "Spin bubble."                                                                 // Download file header.
-#define DLOAD_EXT     "dat"                                                                          // Download file extension.
-#define DLOAD         DLOAD_HOME DLOAD_FILE                                                          // Download file name (full name, timestamp and extension to be added).
-#define ULOAD_FILE    "Upload"                                                                       // Upload file name.
-#define ULOAD_HEAD    "Spin bubble."                                                                 // Upload file header.
-#define ULOAD_EXT     "dat"                                                                          // Upload file extension.
-#define ULOAD         ULOAD_HOME ULOAD_FILE                                                          // Upload file name (full name, timestamp and extension to be added).
 
 // INCLUDES:
 #include "nu.hpp"                                                                                    // Neutrino's header file.
+#include "spin_bubble.hpp"                                                                           // Spin-bubble common definitions.
+#include "coupling.hpp"                                                                              // Coupling table.
+#include "colouring.hpp"                                                                             // Graph colouring.
+#include "snapshot.hpp"                                                                              // Binary snapshots.
+#include "checkpoint.hpp"                                                                            // Checkpoint/restart.
+#include "topology.hpp"                                                                              // Mesh topology cache.
+#include "structured.hpp"                                                                            // Structured grid detection.
+#include "profiler.hpp"                                                                              // Kernel profiling.
+#include "specialise.hpp"                                                                            // Kernel specialisation.
+#include "statistics.hpp"                                                                            // Streaming statistics.
+#include "angle.hpp"                                                                                 // 16-bit fixed-point angles.
 
 int main ()
 {
@@ -86,15 +38,20 @@ int main ()
   size_t              j;                                                                             // Index [#].
   size_t              j_min;                                                                         // Index [#].
   size_t              j_max;                                                                         // Index [#].
+  size_t              c;                                                                             // Colour index [#].
   unsigned int        time_index;                                                                    // Index [#].
   unsigned int        trial_index;                                                                   // Index [#].
-  std::string         trial_text;                                                                    // Trial text, corresponding to trial index.
+  unsigned int        step_index;                                                                    // Step index (since start) [#].
+  size_t              slot;                                                                          // Observable ring slot [#].
   int                 trials;                                                                        // Index [#].
   int                 trials_new;                                                                    // Index [#].
   bool                savedata;                                                                      // Save data flag.
 
   // SEED:
   unsigned int        seed;                                                                          // Seed for C++ rand().
+  int                 rng_mode = RNG_INIT;                                                           // Random generator mode.
+  int                 sampler  = SAMPLER_INIT;                                                       // Single-site sampler.
+  bool                verbose  = VERBOSE_INIT;                                                       // "true" = print per-node diagnostics.
 
   // MOUSE PARAMETERS:
   float               ms_orbit_rate   = 1.0f;                                                        // Orbit rotation rate [rev/s].
@@ -119,26 +76,49 @@ int main ()
   nu::kernel*         K1              = new nu::kernel ();                                           // OpenCL kernel array.
   nu::kernel*         K2              = new nu::kernel ();                                           // OpenCL kernel array.
   nu::kernel*         K3              = new nu::kernel ();                                           // OpenCL kernel array.
-  nu::float4*         color           = new nu::float4 (0);                                          // Color [].
-  nu::float4*         position        = new nu::float4 (1);                                          // Position [m].
-  nu::int1*           central         = new nu::int1 (2);                                            // Central nodes.
-  nu::int1*           neighbour       = new nu::int1 (3);                                            // Neighbour.
-  nu::int1*           offset          = new nu::int1 (4);                                            // Offset.
-  nu::float1*         theta           = new nu::float1 (5);                                          // Theta.
-  nu::float1*         theta_int       = new nu::float1 (6);                                          // Theta (intermediate value).
-  nu::int4*           state_theta     = new nu::int4 (7);                                            // Random generator state.
-  nu::int4*           state_threshold = new nu::int4 (8);                                            // Random generator state.
-  nu::float1*         spin_z_row_sum  = new nu::float1 (9);                                          // z-spin row summation.
-  nu::float1*         spin_z2_row_sum = new nu::float1 (10);                                         // z-spin square row summation.
-  nu::int1*           m_overflow      = new nu::int1 (11);                                           // Rejection sampling overflow.
-  nu::int1*           m_overflow_sum  = new nu::int1 (12);                                           // Rejection sampling overflow sum.
-  nu::float1*         parameter       = new nu::float1 (13);                                         // Parameters array.
+  std::vector<nu::kernel*> K4;                                                                       // OpenCL kernel array (one per colour class).
+  nu::kernel*         K5              = new nu::kernel ();                                           // OpenCL kernel array.
+  nu::kernel*         K6              = new nu::kernel ();                                           // OpenCL kernel array.
+  std::string         options;                                                                       // OpenCL JIT build options.
+  nu::float4*         position        = new nu::float4 (0);                                          // Position [m].
+  nu::int1*           neighbour       = new nu::int1 (1);                                            // Neighbour.
+  nu::int1*           offset          = new nu::int1 (2);                                            // Offset.
+  nu::int1*           theta           = new nu::int1 (3);                                            // Theta (16-bit fixed point, see angle.hpp).
+  nu::int1*           theta_int       = new nu::int1 (4);                                            // Theta (intermediate value, 16-bit fixed point).
+  nu::int4*           state_theta     = new nu::int4 (5);                                            // Random generator state.
+  nu::int4*           state_threshold = new nu::int4 (6);                                            // Random generator state.
+  nu::float1*         spin_z_partial  = new nu::float1 (7);                                          // z-spin partial summation.
+  nu::float1*         spin_z2_partial = new nu::float1 (8);                                          // z-spin square partial summation.
+  nu::int1*           m_overflow      = new nu::int1 (9);                                            // Rejection sampling iterations (16-bit counts).
+  nu::int1*           m_overflow_part = new nu::int1 (10);                                           // Rejection sampling overflow partial summation.
+  nu::float1*         parameter       = new nu::float1 (11);                                         // Parameters array.
+  nu::float1*         coupling        = new nu::float1 (12);                                         // Coupling table.
+  nu::int1*           colour_node     = new nu::int1 (13);                                           // Nodes sorted by colour.
+  nu::int1*           colour_offset   = new nu::int1 (14);                                           // Colour class offsets.
+  nu::float1*         observable      = new nu::float1 (15);                                         // Observables (ring buffer).
+  nu::int1*           step            = new nu::int1 (16);                                           // Step counter.
+  nu::int4*           replica         = new nu::int4 (17);                                           // Replica state (step, trial, status, decay).
+  nu::float1*         energy_partial  = new nu::float1 (18);                                         // Energy partial summation.
+  nu::float1*         temperature     = new nu::float1 (19);                                         // Replica temperature.
+  nu::int1*           grid_node       = new nu::int1 (20);                                           // Structured grid (node of each grid cell).
+  nu::float1*         spectrum        = new nu::float1 (21);                                         // Long-range field spectrum (headless only).
+  nu::float1*         coupling_spectrum = new nu::float1 (22);                                       // Long-range coupling spectrum (headless only).
+  nu::float1*         long_range      = new nu::float1 (23);                                         // Long-range field (headless only).
+  nu::float1*         halo            = new nu::float1 (24);                                         // Halo values (headless only).
+  nu::int1*           halo_node       = new nu::int1 (25);                                           // Boundary nodes (headless only).
+  nu::float1*         iteration_part  = new nu::float1 (26);                                         // Rejection sampling iterations partial summation.
+  std::vector<float>  theta_value;                                                                   // Theta [rad] (host, expanded from "theta").
+  std::vector<float>  theta_int_value;                                                               // Theta (intermediate value) [rad] (host).
 
   // IMGUI:
   nu::imgui*          hud             = new nu::imgui ();                                            // ImGui context.
 
   // MESH:
-  nu::mesh*           vacuum          = new nu::mesh (MESH);                                         // False vacuum domain.
+  nu::mesh*           vacuum          = nullptr;                                                     // False vacuum domain (GMSH mesh).
+  sb::topology*       topo            = new sb::topology ();                                         // False vacuum domain topology (cached).
+  uint64_t            mesh_hash_file;                                                                // GMSH mesh file hash.
+  std::string         topology_file;                                                                 // Topology cache file name.
+  std::vector<int>    node_index;                                                                    // Node indices.
   size_t              nodes;                                                                         // Number of nodes.
   size_t              elements;                                                                      // Number of elements.
   size_t              groups;                                                                        // Number of groups.
@@ -153,6 +133,15 @@ int main ()
   float               x_max         = +1.0f;                                                         // "x_max" spatial boundary [m].
   float               y_min         = -1.0f;                                                         // "y_min" spatial boundary [m].
   float               y_max         = +1.0f;                                                         // "y_max" spatial boundary [m].
+  std::vector<float>  node_x;                                                                        // Node "x" coordinates [m].
+  std::vector<float>  node_y;                                                                        // Node "y" coordinates [m].
+  std::vector<float>  edge;                                                                          // Edge lengths (periodic) [m].
+  size_t              colours;                                                                       // Number of graph colours [#].
+  size_t              colour_nodes;                                                                  // Largest colour class size [#].
+  bool                structured;                                                                    // "true" = regular periodic grid (structured stencil kernel).
+  size_t              grid_columns;                                                                  // Number of grid columns [#].
+  size_t              grid_rows;                                                                     // Number of grid rows [#].
+  size_t              grid_stencil;                                                                  // Grid neighbours per node [#].
   float               dx;                                                                            // x-axis mesh spatial size [m].
   float               dy;                                                                            // y-axis mesh spatial size [m].
 
@@ -166,9 +155,14 @@ int main ()
   float               spin_z_stderr = 0.0f;                                                          // Standard error z-spin.
   float               m_level       = 0.0f;                                                          // Rejection sampling overflow level.
   float               m_max         = M_MAX;                                                         // Maximum allowed number of rejections.
-  float               columns;                                                                       // Numbers of data columns.
   float               ds;                                                                            // Simulation space step [m].
   float               dt;                                                                            // Simulation time step [s].
+  size_t              depth         = OBSERVABLE_DEPTH;                                              // Observable ring depth [steps].
+  bool                colour_mode   = false;                                                         // "true" = graph-coloured in-place update, "false" = Jacobi update.
+  bool                decay         = DECAY_INIT;                                                    // "true" = end the trial when <sz> crosses the decay threshold.
+  float               decay_sz      = DECAY_SZ_INIT;                                                 // Decay threshold on <sz>.
+  float               target_error  = TARGET_ERROR_INIT;                                             // Target standard error of <sz> per trial (0 = fixed trial length).
+  sb::statistics*     stat          = new sb::statistics ();                                         // <sz> statistics.
 
   // ENERGY PROFILE VARIABLES:
   std::vector<float>  data_x;
@@ -180,10 +174,25 @@ int main ()
   nu::logfile*        log           = new nu::logfile ();                                            // Log file.
 
   // DATA DLOAD:
-  nu::logfile*        download      = new nu::logfile ();                                            // Download file.
+  sb::snapshot_writer* snapshot     = new sb::snapshot_writer ();                                    // Download snapshot file.
+  uint64_t            hash;                                                                          // Mesh hash.
 
   // DATA ULOAD;
   nu::logfile*        upload        = new nu::logfile ();                                            // Upload file.
+  sb::snapshot_reader* snapshot_in  = new sb::snapshot_reader ();                                    // Upload snapshot file.
+
+  // CHECKPOINT:
+  sb::checkpoint*     ckpt          = new sb::checkpoint ();                                         // Checkpoint.
+
+  // PROFILING:
+  sb::profiler*       prof          = new sb::profiler ();                                           // Profiler.
+  bool                profile       = PROFILE_INIT;                                                  // "true" = per-kernel and stage timing, timing log.
+  nu::kernel_mode     launch;                                                                        // Kernel launch mode (blocking when profiling).
+  unsigned int        frame_index   = 0;                                                             // Frame index [#].
+  size_t              frame_steps;                                                                   // Steps run in the current frame [#].
+  std::chrono::steady_clock::time_point frame_start;                                                 // Frame start time.
+  double              iterations;                                                                    // Rejection sampling iterations summation.
+  uint64_t            ckpt_value;                                                                    // Checkpoint check value.
   std::vector<int>    upload_i;
   std::vector<float>  upload_x;
   std::vector<float>  upload_y;
@@ -192,13 +201,49 @@ int main ()
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   ///////////////////////////////////////// DATA INITIALIZATION //////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////////////////////////
-  // MESH "X" SIDE:
-  vacuum->process (SIDE_X_TAG, SIDE_X_DIM, nu::MSH_PNT);                                             // Processing mesh...
-  side_x_nodes    = vacuum->node.size ();                                                            // Getting number of nodes along "x" side...
+  // MESH TOPOLOGY (processed topology cached by mesh file hash):
+  mesh_hash_file  = sb::file_hash (MESH);                                                            // Computing mesh file hash...
+  topology_file   = sb::topology::file_name (LOG_HOME, mesh_hash_file);                              // Setting topology cache file name...
+
+  if(!topo->load (topology_file, mesh_hash_file))
+  {
+    vacuum = new nu::mesh (MESH);                                                                    // Opening GMSH mesh...
+
+    // MESH "X" SIDE:
+    vacuum->process (SIDE_X_TAG, SIDE_X_DIM, nu::MSH_PNT);                                           // Processing mesh...
+    topo->side_x_nodes = vacuum->node.size ();                                                       // Getting number of nodes along "x" side...
+
+    // MESH "Y" SIDE:
+    vacuum->process (SIDE_Y_TAG, SIDE_Y_DIM, nu::MSH_PNT);                                           // Processing mesh...
+    topo->side_y_nodes = vacuum->node.size ();                                                       // Getting number of nodes along "y" side...
+
+    // MESH SURFACE:
+    vacuum->process (SURFACE_TAG, SURFACE_DIM, nu::MSH_QUA_4);                                       // Processing mesh...
+    topo->node      = vacuum->node;                                                                  // Getting node indices...
+    topo->neighbour = vacuum->neighbour;                                                             // Getting neighbour indices...
+    topo->offset    = vacuum->neighbour_offset;                                                      // Getting neighbour offsets...
+    topo->elements  = vacuum->element.size ();                                                       // Getting number of element vertices...
+    topo->groups    = vacuum->group.size ();                                                         // Getting number of group vertices...
+    topo->position.resize (4*vacuum->node_coordinates.size ());                                      // Sizing node coordinates...
+
+    for(i = 0; i < vacuum->node_coordinates.size (); i++)
+    {
+      topo->position[4*i + 0] = vacuum->node_coordinates[i].x;                                       // Getting node "x" coordinate...
+      topo->position[4*i + 1] = vacuum->node_coordinates[i].y;                                       // Getting node "y" coordinate...
+      topo->position[4*i + 2] = vacuum->node_coordinates[i].z;                                       // Getting node "z" coordinate...
+      topo->position[4*i + 3] = vacuum->node_coordinates[i].w;                                       // Getting node "w" coordinate...
+    }
 
-  // MESH "Y" SIDE:
-  vacuum->process (SIDE_Y_TAG, SIDE_Y_DIM, nu::MSH_PNT);                                             // Processing mesh...
-  side_y_nodes    = vacuum->node.size ();                                                            // Getting number of nodes along "y" side...
+    // MESH BORDER:
+    vacuum->process (BORDER_TAG, BORDER_DIM, nu::MSH_PNT);                                           // Processing mesh...
+    topo->border    = vacuum->node;                                                                  // Getting nodes on border...
+
+    topo->save (topology_file, mesh_hash_file);                                                      // Saving topology cache...
+    std::cout << "topology cached to " << topology_file << "." << std::endl;                         // Printing message...
+  }
+
+  side_x_nodes    = topo->side_x_nodes;                                                              // Getting number of nodes along "x" side...
+  side_y_nodes    = topo->side_y_nodes;                                                              // Getting number of nodes along "y" side...
 
   // COMPUTING PHYSICAL PARAMETERS:
   dx              = (x_max - x_min)/(side_x_nodes - 1);                                              // x-axis mesh spatial size [m].
@@ -206,18 +251,26 @@ int main ()
   ds              = dx;                                                                              // Setting space step [m].
   dt              = 0.0f;                                                                            // Resetting time step [s].
 
-  // COMPUTING DATA PROPERTIES:
-  columns         = (float)side_x_nodes;                                                             // Setting numbers od data columns...
-
   // MESH SURFACE:
-  vacuum->process (SURFACE_TAG, SURFACE_DIM, nu::MSH_QUA_4);                                         // Processing mesh...
-  position->data  = vacuum->node_coordinates;                                                        // Setting all node coordinates...
-  neighbour->data = vacuum->neighbour;                                                               // Setting neighbour indices...
-  offset->data    = vacuum->neighbour_offset;                                                        // Setting neighbour offsets...
-  nodes           = vacuum->node.size ();                                                            // Getting the number of nodes...
-  elements        = vacuum->element.size ();                                                         // Getting the number of elements...
-  groups          = vacuum->group.size ();                                                           // Getting the number of groups...
-  neighbours      = vacuum->neighbour.size ();                                                       // Getting the number of neighbours...
+  nodes           = topo->node.size ();                                                              // Getting the number of nodes...
+  elements        = topo->elements;                                                                  // Getting the number of elements...
+  groups          = topo->groups;                                                                    // Getting the number of groups...
+  position->data.resize (nodes);                                                                     // Sizing node coordinates...
+
+  for(i = 0; i < nodes; i++)
+  {
+    position->data[i] = {
+                         topo->position[4*i + 0],
+                         topo->position[4*i + 1],
+                         topo->position[4*i + 2],
+                         topo->position[4*i + 3]
+                        };                                                                           // Setting node coordinates...
+  }
+
+  neighbour->data.swap (topo->neighbour);                                                            // Setting neighbour indices...
+  offset->data.swap (topo->offset);                                                                  // Setting neighbour offsets...
+  node_index.swap (topo->node);                                                                      // Setting node indices...
+  neighbours      = neighbour->data.size ();                                                         // Getting the number of neighbours...
   std::cout << "nodes = " << nodes << std::endl;                                                     // Printing message...
   std::cout << "elements = " << elements/CELL_VERTICES << std::endl;                                 // Printing message...
   std::cout << "groups = " << groups/CELL_VERTICES << std::endl;                                     // Printing message...
@@ -227,21 +280,30 @@ int main ()
   seed            = (unsigned int)time (NULL);                                                       // Generating seed for C++ rand()...
   srand (seed);                                                                                      // Setting C++ rand() seed...
 
+  // SETTING RANDOM GENERATOR STATES (xoshiro128++ only, Philox is stateless and keeps a placeholder):
+  state_theta->data.resize ((rng_mode == RNG_XOSHIRO) ? nodes : 1);                                  // Sizing random generator state...
+  state_threshold->data.resize (state_theta->data.size ());                                          // Sizing random generator state...
+
+  for(i = 0; i < state_theta->data.size (); i++)
+  {
+    state_theta->data[i]     = {rand (), rand (), rand (), rand ()};                                 // Setting state_sz seed...
+    state_threshold->data[i] = {rand (), rand (), rand (), rand ()};                                 // Setting state_th seed...
+  }
+
   // SETTING NEUTRINO ARRAYS ("surface" depending):
+  theta_value.assign (nodes, theta_start);                                                           // Setting initial theta...
+  theta_int_value.assign (nodes, theta_start);                                                       // Setting initial theta (intermediate value)...
+  m_overflow->data.assign (sb::packed_size (nodes), 0);                                              // Resetting rejection sampling iterations...
+  upload_theta.assign (nodes, theta_start);                                                          // Setting initial theta...
+  upload_i.resize (nodes);                                                                           // Sizing initial index...
+  upload_x.resize (nodes);                                                                           // Sizing initial x...
+  upload_y.resize (nodes);                                                                           // Sizing initial y...
+
   for(i = 0; i < nodes; i++)
   {
-    std::cout << "i = " << i << ", node index = " << vacuum->node[i] << ", neighbour indices:";      // Printing message...
-
-    state_theta->data.push_back ({rand (), rand (), rand (), rand ()});                              // Setting state_sz seed...
-    state_threshold->data.push_back ({rand (), rand (), rand (), rand ()});                          // Setting state_th seed...
-    color->data.push_back ({0.0f, 1.0f, 0.0f, 1.0f});                                                // Setting node color...
-    theta->data.push_back (theta_start);                                                             // Setting initial theta...
-    upload_i.push_back (i);                                                                          // Setting initial index...
-    upload_x.push_back (position->data[i].x);                                                        // Setting initial x...
-    upload_y.push_back (position->data[i].y);                                                        // Setting initial x...
-    upload_theta.push_back (theta_start);                                                            // Setting initial theta...
-    theta_int->data.push_back (theta_start);                                                         // Setting initial theta (intermediate value)...
-    m_overflow->data.push_back (0);                                                                  // Resetting rejection sampling overflow...
+    upload_i[i] = i;                                                                                 // Setting initial index...
+    upload_x[i] = position->data[i].x;                                                               // Setting initial x...
+    upload_y[i] = position->data[i].y;                                                               // Setting initial y...
 
     // Computing minimum element offset index:
     if(i == 0)
@@ -255,26 +317,33 @@ int main ()
 
     j_max = offset->data[i];                                                                         // Setting maximum element offset index...
 
-    for(j = j_min; j < j_max; j++)
+    // Printing node neighbours (diagnostics only):
+    if(verbose)
     {
-      central->data.push_back (vacuum->node[i]);                                                     // Building central node tuple...
+      std::cout << "i = " << i << ", node index = " << node_index[i] << ", neighbour indices:";      // Printing message...
 
-      std::cout << " " << neighbour->data[j];                                                        // Printing message...
-    }
+      for(j = j_min; j < j_max; j++)
+      {
+        std::cout << " " << neighbour->data[j];                                                      // Printing message...
+      }
 
-    std::cout << std::endl;                                                                          // Printing message...
+      std::cout << std::endl;                                                                        // Printing message...
+    }
   }
 
-  for(i = 0; i < side_y_nodes; i++)
-  {
-    spin_z_row_sum->data.push_back (0.0f);                                                           // Resetting z-spin row summation...
-    spin_z2_row_sum->data.push_back (0.0f);                                                          // Resetting z-spin square row summation...
-    m_overflow_sum->data.push_back (0);                                                              // Resetting rejection sampling overflow sum...
-  }
+  // SETTING REDUCTION ARRAYS:
+  spin_z_partial->data.assign (REDUCTION_ITEMS, 0.0f);                                               // Resetting z-spin partial summation...
+  spin_z2_partial->data.assign (REDUCTION_ITEMS, 0.0f);                                              // Resetting z-spin square partial summation...
+  m_overflow_part->data.assign (REDUCTION_ITEMS, 0);                                                 // Resetting rejection sampling overflow partial summation...
+  energy_partial->data.assign (REDUCTION_ITEMS, 0.0f);                                               // Resetting energy partial summation...
+  iteration_part->data.assign (REDUCTION_ITEMS, 0.0f);                                               // Resetting rejection sampling iterations partial summation...
+  observable->data.assign (depth*OBSERVABLES, 0.0f);                                                 // Resetting observables...
+  step->data.assign (2, 0);                                                                          // Resetting step counter and K3 work-groups...
+  replica->data.push_back ({0, 0, REPLICA_RUNNING, 0});                                              // Setting single replica (always running)...
+  temperature->data.push_back (T);                                                                   // Setting single replica temperature...
 
   // MESH BORDER:
-  vacuum->process (BORDER_TAG, BORDER_DIM, nu::MSH_PNT);                                             // Processing mesh...
-  border       = vacuum->node;                                                                       // Getting nodes on border...
+  border       = topo->border;                                                                       // Getting nodes on border...
   border_nodes = border.size ();                                                                     // Getting the number of nodes on border...
 
   // SETTING NEUTRINO ARRAYS ("border" depending):
@@ -289,9 +358,92 @@ int main ()
   parameter->data.push_back (Hx);                                                                    // Setting longitudinal magnetic field parameter...
   parameter->data.push_back (Hz);                                                                    // Setting transverse magnetic field parameter...
   parameter->data.push_back (m_max);                                                                 // Setting maximum allowed number of rejections parameter...
-  parameter->data.push_back (columns);                                                               // Setting number of mesh columns parameter...
+  parameter->data.push_back ((float)nodes);                                                          // Setting number of nodes parameter...
   parameter->data.push_back (dx);                                                                    // Setting simualtion spatial step parameter...
   parameter->data.push_back (dt);                                                                    // Setting simulation time step parameter...
+  parameter->data.push_back (0.0f);                                                                  // Setting colour class parameter (unused, see SB_COLOUR in thekernel_4.cl)...
+  parameter->data.push_back ((float)depth);                                                          // Setting observable ring depth parameter...
+  parameter->data.push_back ((float)REDUCTION_ITEMS);                                                // Setting number of partial summations parameter...
+  parameter->data.push_back ((float)REPLICAS_INIT);                                                  // Setting number of replicas parameter...
+  parameter->data.push_back (0.0f);                                                                  // Setting trial length parameter (unlimited: auto-restart on host)...
+  parameter->data.push_back ((float)rng_mode);                                                       // Setting random generator mode parameter...
+  parameter->data.push_back ((float)(seed & 0xFFFF));                                                // Setting random generator seed parameter (low half)...
+  parameter->data.push_back ((float)(seed >> 16));                                                   // Setting random generator seed parameter (high half)...
+  parameter->data.push_back (0.0f);                                                                  // Setting grid columns parameter (structured grid only)...
+  parameter->data.push_back (0.0f);                                                                  // Setting grid rows parameter (structured grid only)...
+  parameter->data.push_back (0.0f);                                                                  // Setting grid stencil parameter (0 = unstructured mesh)...
+  parameter->data.push_back ((float)sampler);                                                        // Setting single-site sampler parameter...
+  parameter->data.push_back ((float)nodes);                                                          // Setting CSR rows parameter...
+  parameter->data.push_back (decay_sz);                                                              // Setting decay threshold parameter...
+  parameter->data.push_back (decay ? 1.0f : 0.0f);                                                   // Setting decay detection parameter...
+  parameter->data.push_back (0.0f);                                                                  // Setting long-range field parameter (neighbours only)...
+  parameter->data.push_back (0.0f);                                                                  // Setting first CSR row node parameter...
+  parameter->data.push_back (0.0f);                                                                  // Setting compact neighbour indices parameter (full indices)...
+  parameter->data.push_back (0.0f);                                                                  // Setting boundary nodes parameter (single partition)...
+  parameter->data.push_back (0.0f);                                                                  // Setting energy reduction parameter (energy not plotted)...
+
+  // SETTING COUPLING TABLE:
+  for(i = 0; i < nodes; i++)
+  {
+    node_x.push_back (position->data[i].x);                                                          // Getting node "x" coordinate...
+    node_y.push_back (position->data[i].y);                                                          // Getting node "y" coordinate...
+  }
+
+  edge           = sb::edge_length (
+                                    node_x,
+                                    node_y,
+                                    neighbour->data,
+                                    offset->data,
+                                    sb::period (node_x, side_x_nodes),
+                                    sb::period (node_y, side_y_nodes)
+                                   );                                                                // Computing edge lengths...
+  coupling->data = sb::coupling (edge, ds, alpha);                                                   // Computing coupling table...
+  hash           = sb::mesh_hash (node_x, node_y, neighbour->data, offset->data);                    // Computing mesh hash...
+
+  // DETECTING STRUCTURED GRID (implicit stencil kernel K6 instead of K1 for the Jacobi update):
+  if(sb::structured_grid (
+                         node_x,
+                         node_y,
+                         neighbour->data,
+                         offset->data,
+                         edge,
+                         ds,
+                         grid_node->data,
+                         grid_columns,
+                         grid_rows,
+                         grid_stencil
+                        ))
+  {
+    parameter->data[16] = (float)grid_columns;                                                       // Setting grid columns parameter...
+    parameter->data[17] = (float)grid_rows;                                                          // Setting grid rows parameter...
+    parameter->data[18] = (float)grid_stencil;                                                       // Setting grid stencil parameter...
+    structured          = true;                                                                      // Setting structured grid flag...
+    std::cout << "structured grid: " << grid_columns << " x " << grid_rows << ", "
+              << grid_stencil << " neighbours." << std::endl;                                        // Printing message...
+  }
+  else
+  {
+    grid_node->data.assign (1, 0);                                                                   // Setting placeholder grid...
+    structured          = false;                                                                     // Setting structured grid flag...
+  }
+
+
+  // SETTING LONG-RANGE COUPLING (placeholders, the long-range mode runs headless):
+  spectrum->data.assign (1, 0.0f);                                                                   // Setting placeholder spectrum...
+  coupling_spectrum->data.assign (1, 0.0f);                                                          // Setting placeholder spectrum...
+  long_range->data.assign (1, 0.0f);                                                                 // Setting placeholder field...
+  halo->data.assign (1, 0.0f);                                                                       // Setting placeholder halo values...
+  halo_node->data.assign (1, 0);                                                                     // Setting placeholder boundary nodes...
+
+  // SETTING GRAPH COLOURING:
+  colour_nodes   = sb::colour_classes (
+                                       sb::colour (neighbour->data, offset->data),
+                                       colour_node->data,
+                                       colour_offset->data
+                                      );                                                             // Colouring mesh graph...
+  colours        = colour_offset->data.size ();                                                      // Getting number of colours...
+  std::cout << "colours = " << colours << " (largest class = " << colour_nodes << " nodes)"
+            << std::endl;                                                                            // Printing message...
 
 
   // SETTING INITIAL ENERGY PROFILE:
@@ -310,18 +462,69 @@ int main ()
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   //////////////////////////////////// OPENCL KERNELS INITIALIZATION /////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////////////////////////
+  // SPECIALISING KERNELS (run constants as JIT build options, node counts exact, m_max at run time):
+  options = sb::kernel_options (parameter->data, {{5, nodes}, {20, nodes}}, {4});                    // Getting build options (m_max set at run time)...
+  K0->compiler_options = options;                                                                    // Setting JIT build options...
+  K1->compiler_options = options;                                                                    // Setting JIT build options...
+  K2->compiler_options = options;                                                                    // Setting JIT build options...
+  K3->compiler_options = options;                                                                    // Setting JIT build options...
+  K5->compiler_options = options;                                                                    // Setting JIT build options...
+  K6->compiler_options = options;                                                                    // Setting JIT build options...
+
   K0->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                               // Setting kernel source file...
+  K0->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                   // Setting kernel source file...
   K0->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_0));                                // Setting kernel source file...
   K0->build (nodes, 0, 0);                                                                           // Building kernel program...
   K1->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                               // Setting kernel source file...
+  K1->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                   // Setting kernel source file...
+  K1->addsource (std::string (KERNEL_HOME) + std::string (HEATBATH));                                // Setting kernel source file...
+  K1->addsource (std::string (KERNEL_HOME) + std::string (METROPOLIS));                              // Setting kernel source file...
   K1->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_1));                                // Setting kernel source file...
   K1->build (nodes, 0, 0);                                                                           // Building kernel program...
   K2->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                               // Setting kernel source file...
+  K2->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                   // Setting kernel source file...
   K2->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_2));                                // Setting kernel source file...
   K2->build (nodes, 0, 0);                                                                           // Building kernel program...
   K3->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                               // Setting kernel source file...
+  K3->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                   // Setting kernel source file...
+  K3->addsource (std::string (KERNEL_HOME) + std::string (HEATBATH));                                // Setting kernel source file...
+  K3->addsource (std::string (KERNEL_HOME) + std::string (METROPOLIS));                              // Setting kernel source file...
   K3->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_3));                                // Setting kernel source file...
-  K3->build (side_y_nodes, 0, 0);                                                                    // Building kernel program...
+  K3->build (REDUCTION_ITEMS, 0, 0);                                                                 // Building kernel program...
+  K5->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                               // Setting kernel source file...
+  K5->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                   // Setting kernel source file...
+  K5->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_5));                                // Setting kernel source file...
+  K5->build (1, 0, 0);                                                                               // Building kernel program...
+
+  for(c = 0; c < colours; c++)
+  {
+    K4.push_back (new nu::kernel ());                                                                // Adding colour phase kernel...
+    K4[c]->compiler_options = options + " -D SB_COLOUR=" + std::to_string (c) + "u";                 // Setting JIT build options (colour class)...
+    K4[c]->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                          // Setting kernel source file...
+    K4[c]->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                              // Setting kernel source file...
+    K4[c]->addsource (std::string (KERNEL_HOME) + std::string (HEATBATH));                           // Setting kernel source file...
+    K4[c]->addsource (std::string (KERNEL_HOME) + std::string (METROPOLIS));                         // Setting kernel source file...
+    K4[c]->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_4));                           // Setting kernel source file...
+    K4[c]->build (
+                  colour_offset->data[c] - ((c == 0) ? 0 : colour_offset->data[c - 1]),
+                  0,
+                  0
+                 );                                                                                  // Building kernel program (colour class size)...
+  }
+
+  if(structured)
+  {
+    K6->addsource (std::string (KERNEL_HOME) + std::string (UTILITIES));                             // Setting kernel source file...
+    K6->addsource (std::string (KERNEL_HOME) + std::string (ANGLE));                                 // Setting kernel source file...
+    K6->addsource (std::string (KERNEL_HOME) + std::string (HEATBATH));                              // Setting kernel source file...
+    K6->addsource (std::string (KERNEL_HOME) + std::string (METROPOLIS));                            // Setting kernel source file...
+    K6->addsource (std::string (KERNEL_HOME) + std::string (KERNEL_6));                              // Setting kernel source file...
+    K6->build (
+               (grid_columns + GRID_TILE - 1)/GRID_TILE*GRID_TILE,
+               (grid_rows + GRID_TILE - 1)/GRID_TILE*GRID_TILE,
+               0
+              );                                                                                     // Building kernel program (whole 16 x 16 work-groups)...
+  }
 
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   //////////////////////////////////// OPENGL SHADERS INITIALIZATION /////////////////////////////////
@@ -334,15 +537,10 @@ int main ()
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////// SETTING OPENCL KERNEL ARGUMENTS /////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////////////////////////
+  sb::pack_angles (theta_value, theta->data);                                                        // Packing theta...
+  sb::pack_angles (theta_int_value, theta_int->data);                                                // Packing theta (intermediate value)...
   cl->write ();                                                                                      // Writing OpenCL data...
 
-  ////////////////////////////////////////////////////////////////////////////////////////////////////
-  //////////////////////////////////// CHARGING RANDOM GENERATORS ////////////////////////////////////
-  ////////////////////////////////////////////////////////////////////////////////////////////////////
-  cl->acquire ();                                                                                    // Acquiring OpenCL kernel...
-  cl->execute (K0, nu::WAIT);                                                                        // Executing OpenCL kernel...
-  cl->release ();                                                                                    // Releasing OpenCL kernel...
-
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////////////////////////////// OPENING DATA LOG FILE //////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -350,7 +548,7 @@ int main ()
   savedata    = false;                                                                               // Resetting save data flag...
   time_index  = 0;                                                                                   // Resetting time index...
   trial_index = 0;                                                                                   // Resetting trial index...
-  trial_text  = std::string ("_#") + std::to_string (trial_index);                                   // Updating trial text...
+  step_index  = 0;                                                                                   // Resetting step index...
   trials      = TRIALS_INIT;                                                                         // Setting auto-trial number...
   trials_new  = trials;                                                                              // Setting auto-trial number (new index)...
   log->open (LOG + timestamp, LOG_EXT, LOG_HEAD, "\t", nu::WRITE);                                   // Opening data log file...
@@ -361,47 +559,143 @@ int main ()
   log->write ("#trial");                                                                             // Logging header...
   log->endline ();                                                                                   // Logging header...
 
+  if(profile && !prof->open (std::string (LOG_HOME) + PROFILE_FILE + timestamp + "." + PROFILE_EXT))
+  {
+    std::cout << "Warning: cannot create timing log, profiling disabled." << std::endl;              // Printing message...
+  }
+
+  // Launching every kernel blocking when profiling, so that each one is timed on its own channel:
+  launch      = prof->is_enabled () ? nu::WAIT : nu::DONT_WAIT;                                      // Setting kernel launch mode...
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////// CHARGING RANDOM GENERATORS ////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  if(rng_mode == RNG_XOSHIRO)
+  {
+    cl->acquire ();                                                                                  // Acquiring OpenCL kernel...
+    prof->begin ("K0");                                                                              // Starting kernel timer...
+    cl->execute (K0, nu::WAIT);                                                                      // Executing OpenCL kernel (not for Philox: stateless)...
+    prof->end ("K0");                                                                                // Stopping kernel timer...
+    cl->release ();                                                                                  // Releasing OpenCL kernel...
+  }
+
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////// APPLICATION LOOP ////////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   while(!gl->closed ())                                                                              // Opening window...
   {
     cl->get_tic ();                                                                                  // Getting "tic" [us]...
+    frame_start = std::chrono::steady_clock::now ();                                                 // Getting frame start time...
 
     if(dt > 0.0f)
     {
+      // RUNNING SWEEPS (as many as fit in a frame at FRAME_RATE, at most one observable ring):
+      prof->begin ("interop");                                                                       // Starting interop timer...
       cl->acquire ();                                                                                // Acquiring OpenCL kernel...
-      cl->execute (K1, nu::WAIT);                                                                    // Executing OpenCL kernel...
-      cl->execute (K2, nu::WAIT);                                                                    // Executing OpenCL kernel...
-      cl->execute (K3, nu::WAIT);                                                                    // Executing OpenCL kernel...
+      prof->end ("interop");                                                                         // Stopping interop timer...
+      prof->begin ("sweeps");                                                                        // Starting sweeps timer...
+      frame_steps = 0;                                                                               // Resetting frame steps...
+
+      do
+      {
+        prof->begin ("sweep");                                                                       // Starting sweep timer...
+
+        if(colour_mode)
+        {
+          for(c = 0; c < colours; c++)
+          {
+            prof->begin ("K4");                                                                      // Starting kernel timer...
+            cl->execute (K4[c], launch);                                                             // Executing OpenCL kernel (colour class baked in)...
+            prof->end ("K4");                                                                        // Stopping kernel timer...
+          }
+        }
+        else if(structured)
+        {
+          prof->begin ("K6");                                                                        // Starting kernel timer...
+          cl->execute (K6, launch);                                                                  // Executing OpenCL kernel (structured grid)...
+          prof->end ("K6");                                                                          // Stopping kernel timer...
+        }
+        else
+        {
+          prof->begin ("K1");                                                                        // Starting kernel timer...
+          cl->execute (K1, launch);                                                                  // Executing OpenCL kernel...
+          prof->end ("K1");                                                                          // Stopping kernel timer...
+        }
+
+        prof->begin ("K2");                                                                          // Starting kernel timer...
+        cl->execute (K2, launch);                                                                    // Executing OpenCL kernel...
+        prof->end ("K2");                                                                            // Stopping kernel timer...
+        prof->begin ("K3");                                                                          // Starting kernel timer...
+        cl->execute (K3, launch);                                                                    // Executing OpenCL kernel...
+        prof->end ("K3");                                                                            // Stopping kernel timer...
+        prof->begin ("K5");                                                                          // Starting kernel timer...
+        cl->execute (K5, nu::WAIT);                                                                  // Executing OpenCL kernel (waiting for the whole sweep)...
+        prof->end ("K5");                                                                            // Stopping kernel timer...
+        prof->end ("sweep");                                                                         // Stopping sweep timer...
+        frame_steps++;                                                                               // Updating frame steps...
+      }
+      while((frame_steps < depth) && ((time_index + frame_steps) < (unsigned int)trials_new) &&
+            (std::chrono::duration<double> (
+                                            std::chrono::steady_clock::now () - frame_start
+                                           ).count () < 1.0/FRAME_RATE));
+
+      prof->begin ("read");                                                                          // Starting transfer timer...
+      cl->read (15);                                                                                 // Reading observables...
+      cl->read (17);                                                                                 // Reading replica state...
+      prof->end ("read");                                                                            // Stopping transfer timer...
+      prof->end ("sweeps");                                                                          // Stopping sweeps timer...
+      prof->begin ("interop");                                                                       // Starting interop timer...
       cl->release ();                                                                                // Releasing OpenCL kernel...
-      cl->read (9);                                                                                  // Reading spin_z_row_sum...
-      cl->read (10);                                                                                 // Reading spin_z2_row_sum...
-      cl->read (12);                                                                                 // Reading m_overflow_sum...
+      prof->end ("interop");                                                                         // Stopping interop timer...
 
-      spin_z_avg    = 0.0f;                                                                          // Resetting spin_z average...
-      spin_z_stderr = 0.0f;                                                                          // Resetting spin_z standard error...
-      m_level       = 0.0f;                                                                          // Resetting m_level...
+      slot       = (step_index + frame_steps - 1) % depth;                                           // Getting last observable ring slot...
+      iterations = observable->data[slot*OBSERVABLES + OBS_ITERATIONS];                              // Getting rejection sampling iterations summation (last sweep)...
+      prof->add ("sweeps/s", frame_steps*1.0e6/prof->last ("sweeps"));                               // Adding sample...
+      prof->add ("updates/s", frame_steps*nodes*1.0e6/prof->last ("sweeps"));                        // Adding sample...
+      prof->add ("iterations/node", iterations/nodes);                                               // Adding sample...
 
-      for(i = 0; i < side_y_nodes; i++)
+      // LOGGING ALL STEPS OF THE FRAME (from the observable ring):
+      prof->begin ("log");                                                                           // Starting log timer...
+
+      for(j = 0; j < frame_steps; j++)
       {
-        spin_z_avg    += spin_z_row_sum->data[i];                                                    // Summating spin_z_row_sum by columns...
-        spin_z_stderr += spin_z2_row_sum->data[i];                                                   // Summating spin_z2_row_sum by columns...
-        m_level       += m_overflow_sum->data[i];                                                    // Summating m_overflow_sum by columns...
-      }
+        slot = (step_index + j) % depth;                                                             // Getting observable ring slot...
 
-      spin_z_avg   /= nodes;                                                                         // Computing spin_z average...
-      spin_z_stderr = (float)sqrt (spin_z_stderr/nodes - pow (spin_z_avg, 2))/(float)sqrt (nodes);   // Computing spin_z standard deviation...
-      m_level       = 100.0f*(m_level/nodes);                                                        // Computing rejection sampling overflow level...
+        // Skipping the steps after a decay (replica not running):
+        if(observable->data[slot*OBSERVABLES + OBS_STEP] == 0.0f)
+        {
+          continue;
+        }
+
+        spin_z_avg    = observable->data[slot*OBSERVABLES + OBS_SZ];                                 // Getting z-spin summation...
+        spin_z_stderr = observable->data[slot*OBSERVABLES + OBS_SZ2];                                // Getting z-spin square summation...
+        m_level       = observable->data[slot*OBSERVABLES + OBS_OVERFLOW];                           // Getting rejection sampling overflow summation...
 
-      log->write (time_index);                                                                       // Logging data...
-      log->write (spin_z_avg);                                                                       // Logging data...
-      log->write (spin_z_stderr);                                                                    // Logging data...
-      log->write (m_level);                                                                          // Logging data...
-      log->write (trial_index);                                                                      // Logging data...
-      log->endline ();                                                                               // Ending log line...
+        spin_z_avg   /= nodes;                                                                       // Computing spin_z average...
+        spin_z_stderr = (float)sqrt (spin_z_stderr/nodes - pow (spin_z_avg, 2))/(float)sqrt (nodes); // Computing spin_z standard deviation...
+        m_level       = 100.0f*(m_level/nodes);                                                      // Computing rejection sampling overflow level...
 
-      time_index++;                                                                                  // Updating time_index...
+        log->write (time_index);                                                                     // Logging data...
+        log->write (spin_z_avg);                                                                     // Logging data...
+        log->write (spin_z_stderr);                                                                  // Logging data...
+        log->write (m_level);                                                                        // Logging data...
+        log->write (trial_index);                                                                    // Logging data...
+        log->endline ();                                                                             // Ending log line...
+        stat->add (spin_z_avg);                                                                      // Adding <sz> sample...
+
+        time_index++;                                                                                // Updating time_index...
+      }
+
+      prof->end ("log");                                                                             // Stopping log timer...
+      step_index += frame_steps;                                                                     // Updating step_index...
+
+      // Ending the trial on decay (detected on the device):
+      if(replica->data[0].z == REPLICA_DONE)
+      {
+        std::cout << "trial " << trial_index << " decayed at step " << time_index << "."
+                  << std::endl;                                                                      // Printing message...
+        savedata = true;                                                                             // Setting save data flag...
+      }
     }
 
     if(time_index >= trials_new)
@@ -409,11 +703,22 @@ int main ()
       savedata = true;                                                                               // Setting save data flag...
     }
 
+    // Ending the trial once <sz> is known within the target error:
+    if((target_error > 0.0f) && !savedata && stat->converged (target_error))
+    {
+      std::cout << "trial " << trial_index << " converged at step " << time_index << ": <sz> = "
+                << stat->mean () << " +/- " << stat->error () << ", tau = " << stat->tau () << "."
+                << std::endl;                                                                        // Printing message...
+      savedata = true;                                                                               // Setting save data flag...
+    }
+
     gl->begin ();                                                                                    // Beginning gl...
     gl->poll_events ();                                                                              // Polling gl events...
     gl->mouse_navigation (ms_orbit_rate, ms_pan_rate, ms_decaytime);                                 // Polling mouse...
     gl->gamepad_navigation (gmp_orbit_rate, gmp_pan_rate, gmp_decaytime, gmp_deadzone);              // Polling gamepad...
+    prof->begin ("render");                                                                          // Starting render timer...
     gl->plot (S, pmode, vmode);                                                                      // Plotting shared arguments...
+    prof->end ("render");                                                                            // Stopping render timer...
 
     hud->begin ();                                                                                   // Beginning HUD...
     hud->window ("FALSE VACUUM PARAMETERS", 200);                                                    // Creating window...
@@ -424,6 +729,8 @@ int main ()
     hud->input ("Transverse magnetic field:   ", "[T]   ", "Hz", &Hz);                               // Transverse magnetic field...
     hud->input ("Maximum rejections:          ", "[#]   ", "m_max", &m_max);                         // Maximum rejections...
     hud->input ("Auto-restart trials:         ", "[#]   ", "trials", &trials);                       // Maximum rejections...
+    hud->input ("Decay threshold:             ", "[]    ", "decay_sz", &decay_sz);                   // Decay threshold on <sz>...
+    hud->input ("Target error:                ", "[]    ", "target_error", &target_error);           // Target standard error of <sz>...
 
     if(trials < TRIALS_INIT)
     {
@@ -438,13 +745,20 @@ int main ()
       parameter->data[1] = T;                                                                        // Updating temperature parameter...
       parameter->data[2] = Hx;                                                                       // Updating longitudinal magnetic field parameter...
       parameter->data[3] = Hz;                                                                       // Updating transverse magnetic field parameter...
+      m_max              = fmin (m_max, (float)ANGLE_COUNT_MAX);                                     // Clamping maximum allowed number of rejections (16-bit counts)...
       parameter->data[4] = m_max;                                                                    // Updating maximum allowed number of rejections parameter...
-      parameter->data[5] = columns;                                                                  // Updating number of mesh columns parameter...
+      parameter->data[5] = (float)nodes;                                                             // Updating number of nodes parameter...
       parameter->data[6] = ds;                                                                       // Updating simualtion spatial step parameter...
       parameter->data[7] = dt;                                                                       // Updating simulation time step parameter...
-      cl->write (13);                                                                                // Updating all parameters...
+      parameter->data[21] = decay_sz;                                                                // Updating decay threshold parameter...
+      cl->write (11);                                                                                // Updating all parameters...
+      temperature->data[0] = T;                                                                      // Updating replica temperature...
+      cl->write (19);                                                                                // Updating replica temperature...
+      coupling->data     = sb::coupling (edge, ds, alpha);                                           // Updating coupling table...
+      cl->write (12);                                                                                // Updating coupling table...
 
       trials_new         = trials;                                                                   // Updating trials...
+      stat->clear ();                                                                                // Resetting statistics (new parameters)...
 
       // Setting theta for all nodes:
       for(i = 0; i < nodes; i++)
@@ -473,6 +787,26 @@ int main ()
     hud->timeplot (1, 0.1f*dt, m_level, 0.0f, "Rejections", "[%]", "m_level", "");                   // Plotting m_level...
     hud->lineplot (0, data_x, data_y, "Potential energy", "theta", "V", "V(theta)");                 // Plotting potential energy profile...
 
+    // Timing plots (profiling only):
+    if(profile)
+    {
+      hud->timeplot (2, 0.1f*dt, (float)prof->mean ("sweep"),
+                     (float)prof->percentile ("sweep", 99.0),
+                     "Sweep (host-timed)", "[us]", "mean", "p99");                                   // Plotting sweep time...
+      hud->timeplot (3, 0.1f*dt, (float)prof->mean ("interop"),
+                     (float)prof->percentile ("interop", 99.0),
+                     "GL interop", "[us]", "mean", "p99");                                           // Plotting acquire/release time...
+      hud->timeplot (4, 0.1f*dt, (float)prof->mean ("sweeps/s"), 0.0f,
+                     "Throughput", "[1/s]", "sweeps/s", "");                                         // Plotting sweeps per second...
+      hud->timeplot (5, 0.1f*dt, (float)prof->mean ("iterations/node"), 0.0f,
+                     "Rejection iterations", "[#]", "m/node", "");                                   // Plotting rejection iterations per node...
+    }
+
+    hud->timeplot (6, 0.1f*dt, (float)stat->error (), (float)stat->naive_error (),
+                   "<sz> error", "[]", "blocked", "naive");                                          // Plotting <sz> standard error...
+    hud->timeplot (7, 0.1f*dt, (float)stat->tau (), 0.0f,
+                   "Autocorrelation", "[steps]", "tau_int", "");                                     // Plotting integrated autocorrelation time...
+
     if(hud->button ("[S]tart", 100) || gl->key_S)
     {
       dt = 1.0f;                                                                                     // Setting time step [s].
@@ -492,15 +826,20 @@ int main ()
       // Resetting theta for all nodes:
       for(i = 0; i < nodes; i++)
       {
-        theta->data[i]     = upload_theta[i];                                                        // Setting initial theta...
-        theta_int->data[i] = upload_theta[i];                                                        // Setting initial theta (intermediate value)...
+        theta_value[i]     = upload_theta[i];                                                        // Setting initial theta...
+        theta_int_value[i] = upload_theta[i];                                                        // Setting initial theta (intermediate value)...
       }
 
-      cl->write (5);                                                                                 // Updating theta...
-      cl->write (6);                                                                                 // Updating theta (intermediate)...
+      sb::pack_angles (theta_value, theta->data);                                                    // Packing theta...
+      sb::pack_angles (theta_int_value, theta_int->data);                                            // Packing theta (intermediate value)...
+      cl->write (3);                                                                                 // Updating theta...
+      cl->write (4);                                                                                 // Updating theta (intermediate)...
       cl->acquire ();                                                                                // Acquiring OpenCL kernel...
+      prof->begin ("K2");                                                                            // Starting kernel timer...
       cl->execute (K2, nu::WAIT);                                                                    // Executing OpenCL kernel...
+      prof->end ("K2");                                                                              // Stopping kernel timer...
       cl->release ();                                                                                // Releasing OpenCL kernel...
+      stat->clear ();                                                                                // Resetting statistics...
     }
 
     if(hud->button ("[M]onocular", 100) || gl->key_M)
@@ -517,6 +856,20 @@ int main ()
 
     hud->space (50);                                                                                 // Adding space...
 
+    if(hud->button ("[J]acobi", 100) || gl->key_J)
+    {
+      colour_mode = false;                                                                           // Setting Jacobi update...
+    }
+
+    hud->space (50);                                                                                 // Adding space...
+
+    if(hud->button ("[G]raph colour", 100) || gl->key_G)
+    {
+      colour_mode = true;                                                                            // Setting graph-coloured update...
+    }
+
+    hud->space (50);                                                                                 // Adding space...
+
     if(hud->button ("[E]xit", 100) || gl->key_E)
     {
       gl->close ();                                                                                  // Closing gl...
@@ -527,29 +880,36 @@ int main ()
       if(hud->button ("[D]ownload", 100) || gl->key_D)
       {
         // Downloading data:
-        cl->read (5);                                                                                // Reading theta...
+        cl->read (3);                                                                                // Reading theta...
+        sb::unpack_angles (theta->data, theta_value);                                                // Expanding theta...
+        cl->read (5);                                                                                // Reading random generator state...
+        cl->read (6);                                                                                // Reading random generator state...
 
-        trial_index++;                                                                               // Updating trial_index...
-        trial_text = std::string ("_#") + std::to_string (trial_index);                              // Updating trial text...
-        time_index = 0;                                                                              // Resetting time_index...
-
-        download->open (DLOAD + timestamp + trial_text, DLOAD_EXT, DLOAD_HEAD, "\t", nu::WRITE);     // Opening data log file...
-        download->write ("#index");                                                                  // Logging header...
-        download->write ("#x");                                                                      // Logging header...
-        download->write ("#y");                                                                      // Logging header...
-        download->write ("#theta(x,y)");                                                             // Logging header...
-        download->endline ();                                                                        // Logging header...
-
-        for(i = 0; i < nodes; i++)
+        if(!snapshot->is_open ())
         {
-          download->write (vacuum->node[i]);                                                         // Logging node index...
-          download->write (vacuum->node_coordinates[i].x);                                           // Logging node x-coordinate...
-          download->write (vacuum->node_coordinates[i].y);                                           // Logging node y-coordinate...
-          download->write (theta->data[i]);                                                          // Logging theta(x,y)...
-          download->endline ();                                                                      // Ending log line...
+          snapshot->open (
+                          DLOAD + timestamp + "." + SNAPSHOT_EXT,
+                          hash,
+                          node_index,
+                          node_x,
+                          node_y,
+                          rng_mode == RNG_XOSHIRO
+                         );                                                                          // Opening download snapshot file...
         }
 
-        download->close (nu::WRITE);                                                                 // Closing data download file...
+        snapshot->write (
+                         step_index,
+                         trial_index,
+                         0,
+                         parameter->data,
+                         theta_value.data (),
+                         (const int*)state_theta->data.data (),
+                         (const int*)state_threshold->data.data ()
+                        );                                                                           // Writing download snapshot...
+
+        trial_index++;                                                                               // Updating trial_index...
+        time_index = 0;                                                                              // Resetting time_index...
+        stat->clear ();                                                                              // Resetting statistics...
       }
 
       hud->space (50);                                                                               // Adding space...
@@ -561,70 +921,211 @@ int main ()
         upload_x.clear ();
         upload_theta.clear ();
 
-        upload->open (ULOAD, ULOAD_EXT, ULOAD_HEAD, "\t", nu::READ);                                 // Opening data log file...
-
-        while(!upload->eof ())
+        if(snapshot_in->open (ULOAD + std::string (".") + SNAPSHOT_EXT) &&
+           (snapshot_in->records () > 0))
         {
-          upload->read (&upload_i, &upload_x, &upload_y, &upload_theta);
+          if((snapshot_in->nodes () != nodes) || (snapshot_in->mesh_hash () != hash))
+          {
+            std::cerr << "Error: upload snapshot does not match the mesh." << std::endl;             // Printing message...
+            exit (EXIT_FAILURE);                                                                     // Exiting...
+          }
+
+          upload_theta.assign (
+                               snapshot_in->theta (snapshot_in->records () - 1),
+                               snapshot_in->theta (snapshot_in->records () - 1) + nodes
+                              );                                                                     // Getting last snapshot field...
+          snapshot_in->close ();                                                                     // Closing snapshot file...
         }
+        else
+        {
+          upload->open (ULOAD, ULOAD_EXT, ULOAD_HEAD, "\t", nu::READ);                               // Opening data log file...
+
+          while(!upload->eof ())
+          {
+            upload->read (&upload_i, &upload_x, &upload_y, &upload_theta);
+          }
 
-        upload->close (nu::READ);
+          upload->close (nu::READ);
+        }
 
         // Setting theta for all nodes:
         for(i = 0; i < nodes; i++)
         {
-          theta->data[i]     = upload_theta[i];                                                      // Setting initial theta...
-          theta_int->data[i] = upload_theta[i];                                                      // Setting initial theta (intermediate value)...
+          theta_value[i]     = upload_theta[i];                                                      // Setting initial theta...
+          theta_int_value[i] = upload_theta[i];                                                      // Setting initial theta (intermediate value)...
         }
 
-        cl->write (5);                                                                               // Updating theta...
-        cl->write (6);                                                                               // Updating theta (intermediate)...
+        sb::pack_angles (theta_value, theta->data);                                                  // Packing theta...
+        sb::pack_angles (theta_int_value, theta_int->data);                                          // Packing theta (intermediate value)...
+        cl->write (3);                                                                               // Updating theta...
+        cl->write (4);                                                                               // Updating theta (intermediate)...
         cl->acquire ();                                                                              // Acquiring OpenCL kernel...
+        prof->begin ("K2");                                                                          // Starting kernel timer...
         cl->execute (K2, nu::WAIT);                                                                  // Executing OpenCL kernel...
+        prof->end ("K2");                                                                            // Stopping kernel timer...
         cl->release ();                                                                              // Releasing OpenCL kernel...
 
         savedata = false;                                                                            // Resetting savedata flag...
       }
+
+      hud->space (50);                                                                               // Adding space...
+
+      if(hud->button ("[C]heckpoint", 100) || gl->key_C)
+      {
+        cl->read (3);                                                                                // Reading theta...
+        sb::unpack_angles (theta->data, theta_value);                                                // Expanding theta...
+        cl->read (4);                                                                                // Reading theta (intermediate)...
+        sb::unpack_angles (theta_int->data, theta_int_value);                                        // Expanding theta (intermediate value)...
+        cl->read (5);                                                                                // Reading random generator state...
+        cl->read (6);                                                                                // Reading random generator state...
+        cl->read (9);                                                                                // Reading rejection sampling overflow...
+        cl->read (16);                                                                               // Reading step counter...
+
+        ckpt_value = hash;                                                                           // Setting mesh hash...
+        ckpt->clear ();                                                                              // Resetting checkpoint...
+        ckpt->set ("hash", &ckpt_value, sizeof (ckpt_value));                                        // Setting mesh hash...
+        ckpt->set ("parameter", parameter->data.data (), parameter->data.size ()*sizeof (float));    // Setting parameters...
+        ckpt->set ("temperature", temperature->data.data (), sizeof (float));                        // Setting replica temperature...
+        ckpt->set ("replica", replica->data.data (), sizeof (replica->data[0]));                     // Setting replica state...
+        ckpt->set ("theta", theta_value.data (), nodes*sizeof (float));                              // Setting theta...
+        ckpt->set ("theta_int", theta_int_value.data (), nodes*sizeof (float));                      // Setting theta (intermediate value)...
+        ckpt->set ("state_theta", state_theta->data.data (),
+                   state_theta->data.size ()*sizeof (state_theta->data[0]));                         // Setting random generator state...
+        ckpt->set ("state_threshold", state_threshold->data.data (),
+                   state_threshold->data.size ()*sizeof (state_threshold->data[0]));                 // Setting random generator state...
+        ckpt->set ("m_overflow", m_overflow->data.data (),
+                   m_overflow->data.size ()*sizeof (int));                                           // Setting rejection sampling iterations...
+        ckpt->set ("step", step->data.data (), sizeof (int));                                        // Setting step counter...
+        ckpt->set ("trial_index", &trial_index, sizeof (trial_index));                               // Setting trial index...
+        ckpt->set ("step_index", &step_index, sizeof (step_index));                                  // Setting step index...
+        ckpt->set ("time_index", &time_index, sizeof (time_index));                                  // Setting time index...
+        ckpt->set ("trials", &trials_new, sizeof (trials_new));                                      // Setting auto-restart trials...
+        ckpt->set ("colour_mode", &colour_mode, sizeof (colour_mode));                               // Setting update scheme...
+        ckpt->save (CKPT);                                                                           // Saving checkpoint...
+      }
+
+      hud->space (50);                                                                               // Adding space...
+
+      if(hud->button ("[L]oad checkpoint", 100) || gl->key_L)
+      {
+        if(ckpt->load (CKPT))
+        {
+          ckpt->get ("hash", &ckpt_value, sizeof (ckpt_value));                                      // Getting mesh hash...
+
+          if(ckpt_value != hash)
+          {
+            std::cerr << "Error: checkpoint does not match the mesh." << std::endl;                  // Printing message...
+            exit (EXIT_FAILURE);                                                                     // Exiting...
+          }
+
+          ckpt->get ("parameter", parameter->data.data (), parameter->data.size ()*sizeof (float));  // Getting parameters...
+          ckpt->get ("temperature", temperature->data.data (), sizeof (float));                      // Getting replica temperature...
+          ckpt->get ("replica", replica->data.data (), sizeof (replica->data[0]));                   // Getting replica state...
+          ckpt->get ("theta", theta_value.data (), nodes*sizeof (float));                            // Getting theta...
+          ckpt->get ("theta_int", theta_int_value.data (), nodes*sizeof (float));                    // Getting theta (intermediate value)...
+          ckpt->get ("state_theta", state_theta->data.data (),
+                     state_theta->data.size ()*sizeof (state_theta->data[0]));                       // Getting random generator state...
+          ckpt->get ("state_threshold", state_threshold->data.data (),
+                     state_threshold->data.size ()*sizeof (state_threshold->data[0]));               // Getting random generator state...
+          ckpt->get ("m_overflow", m_overflow->data.data (),
+                     m_overflow->data.size ()*sizeof (int));                                         // Getting rejection sampling iterations...
+          ckpt->get ("step", step->data.data (), sizeof (int));                                      // Getting step counter...
+          ckpt->get ("trial_index", &trial_index, sizeof (trial_index));                             // Getting trial index...
+          ckpt->get ("step_index", &step_index, sizeof (step_index));                                // Getting step index...
+          ckpt->get ("time_index", &time_index, sizeof (time_index));                                // Getting time index...
+          ckpt->get ("trials", &trials_new, sizeof (trials_new));                                    // Getting auto-restart trials...
+          ckpt->get ("colour_mode", &colour_mode, sizeof (colour_mode));                             // Getting update scheme...
+
+          // UPDATING PHYSICAL PARAMETERS:
+          alpha          = parameter->data[0];                                                       // Getting radial exponent...
+          T              = parameter->data[1];                                                       // Getting temperature...
+          Hx             = parameter->data[2];                                                       // Getting longitudinal magnetic field...
+          Hz             = parameter->data[3];                                                       // Getting transverse magnetic field...
+          m_max          = parameter->data[4];                                                       // Getting maximum allowed number of rejections...
+          decay_sz       = parameter->data[21];                                                      // Getting decay threshold...
+          trials         = trials_new;                                                               // Getting auto-restart trials...
+          coupling->data = sb::coupling (edge, ds, alpha);                                           // Updating coupling table...
+
+          sb::pack_angles (theta_value, theta->data);                                                // Packing theta...
+          sb::pack_angles (theta_int_value, theta_int->data);                                        // Packing theta (intermediate value)...
+          cl->write (3);                                                                             // Updating theta...
+          cl->write (4);                                                                             // Updating theta (intermediate)...
+          cl->write (5);                                                                             // Updating random generator state...
+          cl->write (6);                                                                             // Updating random generator state...
+          cl->write (9);                                                                             // Updating rejection sampling overflow...
+          cl->write (11);                                                                            // Updating all parameters...
+          cl->write (12);                                                                            // Updating coupling table...
+          cl->write (16);                                                                            // Updating step counter...
+          cl->write (17);                                                                            // Updating replica state...
+          cl->write (19);                                                                            // Updating replica temperature...
+          cl->acquire ();                                                                            // Acquiring OpenCL kernel...
+          prof->begin ("K2");                                                                        // Starting kernel timer...
+          cl->execute (K2, nu::WAIT);                                                                // Executing OpenCL kernel...
+          prof->end ("K2");                                                                          // Stopping kernel timer...
+          cl->release ();                                                                            // Releasing OpenCL kernel...
+
+          savedata = false;                                                                          // Resetting savedata flag...
+        }
+        else
+        {
+          std::cout << "No checkpoint found (" << CKPT << ")." << std::endl;                         // Printing message...
+        }
+      }
     }
 
     if(savedata)
     {
       // Downloading data:
-      cl->read (5);                                                                                  // Reading theta...
+      cl->read (3);                                                                                  // Reading theta...
+      sb::unpack_angles (theta->data, theta_value);                                                  // Expanding theta...
+      cl->read (5);                                                                                  // Reading random generator state...
+      cl->read (6);                                                                                  // Reading random generator state...
 
-      trial_index++;                                                                                 // Updating trial_index...
-      trial_text = std::string ("_#") + std::to_string (trial_index);                                // Updating trial text...
-      time_index = 0;                                                                                // Resetting time_index...
-
-      download->open (DLOAD + timestamp + trial_text, DLOAD_EXT, DLOAD_HEAD, "\t", nu::WRITE);       // Opening data log file...
-      download->write ("#index");                                                                    // Logging header...
-      download->write ("#x");                                                                        // Logging header...
-      download->write ("#y");                                                                        // Logging header...
-      download->write ("#theta(x,y)");                                                               // Logging header...
-      download->endline ();                                                                          // Logging header...
-
-      for(i = 0; i < nodes; i++)
+      if(!snapshot->is_open ())
       {
-        download->write (vacuum->node[i]);                                                           // Logging node index...
-        download->write (vacuum->node_coordinates[i].x);                                             // Logging node x-coordinate...
-        download->write (vacuum->node_coordinates[i].y);                                             // Logging node y-coordinate...
-        download->write (theta->data[i]);                                                            // Logging theta(x,y)...
-        download->endline ();                                                                        // Ending log line...
+        snapshot->open (
+                        DLOAD + timestamp + "." + SNAPSHOT_EXT,
+                        hash,
+                        node_index,
+                        node_x,
+                        node_y,
+                        rng_mode == RNG_XOSHIRO
+                       );                                                                            // Opening download snapshot file...
       }
 
-      download->close (nu::WRITE);                                                                   // Closing data download file...
+      snapshot->write (
+                       step_index,
+                       trial_index,
+                       0,
+                       parameter->data,
+                       theta_value.data (),
+                       (const int*)state_theta->data.data (),
+                       (const int*)state_threshold->data.data ()
+                      );                                                                             // Writing download snapshot...
+
+      trial_index++;                                                                                 // Updating trial_index...
+      time_index = 0;                                                                                // Resetting time_index...
+      stat->clear ();                                                                                // Resetting statistics...
 
       // Resetting theta for all nodes:
       for(i = 0; i < nodes; i++)
       {
-        theta->data[i]     = upload_theta[i];                                                        // Setting initial theta...
-        theta_int->data[i] = upload_theta[i];                                                        // Setting initial theta (intermediate value)...
+        theta_value[i]     = upload_theta[i];                                                        // Setting initial theta...
+        theta_int_value[i] = upload_theta[i];                                                        // Setting initial theta (intermediate value)...
       }
 
-      cl->write (5);                                                                                 // Updating theta...
-      cl->write (6);                                                                                 // Updating theta (intermediate)...
+      replica->data[0].z = REPLICA_RUNNING;                                                          // Restarting replica (after a decay)...
+      replica->data[0].w = DECAY_UNKNOWN;                                                            // Resetting decay side...
+
+      sb::pack_angles (theta_value, theta->data);                                                    // Packing theta...
+      sb::pack_angles (theta_int_value, theta_int->data);                                            // Packing theta (intermediate value)...
+      cl->write (3);                                                                                 // Updating theta...
+      cl->write (4);                                                                                 // Updating theta (intermediate)...
+      cl->write (17);                                                                                // Updating replica state...
       cl->acquire ();                                                                                // Acquiring OpenCL kernel...
+      prof->begin ("K2");                                                                            // Starting kernel timer...
       cl->execute (K2, nu::WAIT);                                                                    // Executing OpenCL kernel...
+      prof->end ("K2");                                                                              // Stopping kernel timer...
       cl->release ();                                                                                // Releasing OpenCL kernel...
 
       savedata = false;                                                                              // Resetting savedata flag...
@@ -635,6 +1136,15 @@ int main ()
     hud->end ();                                                                                     // Ending HUD...
 
     gl->end ();                                                                                      // Ending gl...
+
+    // WRITING TIMING LOG (every PROFILE_INTERVAL frames):
+    frame_index++;                                                                                   // Updating frame index...
+
+    if((frame_index % PROFILE_INTERVAL) == 0)
+    {
+      prof->write (step_index);                                                                      // Writing timing log...
+    }
+
     cl->get_toc ();                                                                                  // Getting "toc" [us]...
   }
 
@@ -650,11 +1160,24 @@ int main ()
   delete gl;                                                                                         // Deleting OpenGL context...
   delete hud;                                                                                        // Deleting HUD context...
   delete S;                                                                                          // Deleting shader...
-  delete color;                                                                                      // Deleting color data...
   delete position;                                                                                   // Deleting position data...
-  delete central;                                                                                    // Deleting centrals...
   delete neighbour;                                                                                  // Deleting neighbours...
   delete offset;                                                                                     // Deleting offset...
+  delete coupling;                                                                                   // Deleting coupling table...
+  delete colour_node;                                                                                // Deleting colour classes...
+  delete colour_offset;                                                                              // Deleting colour class offsets...
+  delete observable;                                                                                 // Deleting observables...
+  delete step;                                                                                       // Deleting step counter...
+  delete replica;                                                                                    // Deleting replica state...
+  delete energy_partial;                                                                             // Deleting energy partial summation...
+  delete iteration_part;                                                                             // Deleting rejection sampling iterations partial summation...
+  delete grid_node;                                                                                  // Deleting structured grid...
+  delete spectrum;                                                                                   // Deleting long-range field spectrum...
+  delete coupling_spectrum;                                                                          // Deleting long-range coupling spectrum...
+  delete long_range;                                                                                 // Deleting long-range field...
+  delete halo;                                                                                       // Deleting halo values...
+  delete halo_node;                                                                                  // Deleting boundary nodes...
+  delete temperature;                                                                                // Deleting replica temperature...
   delete theta;                                                                                      // Deleting theta...
   delete theta_int;                                                                                  // Deleting theta (intermediate)...
   delete state_theta;                                                                                // Deleting random generator state...
@@ -663,9 +1186,22 @@ int main ()
   delete K1;                                                                                         // Deleting OpenCL kernel...
   delete K2;                                                                                         // Deleting OpenCL kernel...
   delete K3;                                                                                         // Deleting OpenCL kernel...
+  delete K5;                                                                                         // Deleting OpenCL kernel...
+  delete K6;                                                                                         // Deleting OpenCL kernel...
+
+  for(c = 0; c < K4.size (); c++)
+  {
+    delete K4[c];                                                                                    // Deleting OpenCL kernel (colour phase)...
+  }
+
   delete vacuum;                                                                                     // Deleting vacuum mesh...
+  delete topo;                                                                                       // Deleting vacuum topology...
   delete log;                                                                                        // Deleting log file object...
-  delete download;                                                                                   // Deleting log file object...
+  delete snapshot;                                                                                   // Deleting snapshot file object...
+  delete snapshot_in;                                                                                // Deleting snapshot file object...
+  delete ckpt;                                                                                       // Deleting checkpoint...
+  delete prof;                                                                                       // Deleting profiler...
+  delete stat;                                                                                       // Deleting statistics...
   delete upload;                                                                                     // Deleting log file object...
 
   return 0;
@@ -0,0 +1,212 @@
+/// @file     angle.cpp
+/// @date     16OCT2026
+/// @brief    16-bit fixed-point angle test.
+/// @details  Checks the kernel encoder and decoder (angle.cl, see angle.hpp): round trip within half
+/// a fixed-point step (plus float rounding) for angles of any turn, and the packed host transfer of
+/// an odd number of angles. Then runs the heat-bath update (heatbath.cl) on a small periodic lattice
+/// twice, once with float theta and once with theta stored as 16-bit fixed point as on the device,
+/// and checks that the means of the z-spin and of the energy agree within TEST_SIGMAS errors.
+
+// INCLUDES:
+#include "angle.hpp"                                                                                 // 16-bit fixed-point angles.
+#include "heatbath.hpp"                                                                              // Heat-bath draw.
+#include "statistics.hpp"                                                                            // Streaming statistics.
+
+#include <iostream>
+#include <random>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#define TEST_ANGLES    1000001                                                                       // Round trip angles (odd: half word).
+#define TEST_ROUNDING  1.1                                                                           // Round trip tolerance [half steps].
+#define TEST_SIDE      16                                                                            // Lattice side [#].
+#define TEST_WARMUP    1000                                                                          // Thermalization sweeps.
+#define TEST_SWEEPS    20000                                                                         // Measured sweeps.
+#define TEST_SIGMAS    5.0                                                                           // Tolerance [standard errors].
+#define TEST_T         2.0f                                                                          // Temperature.
+#define TEST_HX        0.5f                                                                          // Longitudinal magnetic field.
+#define TEST_HZ        0.1f                                                                          // Transverse magnetic field.
+#define TEST_C         1.0f                                                                          // Nearest-neighbour coupling.
+
+// Heat-bath lattice run (4-neighbour periodic lattice, z-spin and energy per node of every sweep;
+// "loc_fixed" = theta stored as 16-bit fixed point, as on the device):
+static void run_lattice (
+                         bool            loc_fixed,                                                  // "true" = 16-bit theta.
+                         unsigned int    loc_seed,                                                   // Random seed.
+                         sb::statistics& loc_sz,                                                     // z-spin statistics.
+                         sb::statistics& loc_energy                                                  // Energy statistics.
+                        )
+{
+  std::mt19937                          generator (loc_seed);                                        // Random generator.
+  std::uniform_real_distribution<float> flat (0.0f, 1.0f);                                           // Flat distribution in [0, 1).
+  std::vector<float>                    theta (TEST_SIDE*TEST_SIDE, 0.0f);                           // Theta (float path).
+  std::vector<sb::ushort>               fixed (TEST_SIDE*TEST_SIDE, 0);                              // Theta (16-bit path).
+  size_t                                n;                                                           // Node index [#].
+  size_t                                s;                                                           // Sweep index [#].
+  int                                   x;                                                           // Node column [#].
+  int                                   y;                                                           // Node row [#].
+  float                                 h;                                                           // Neighbour local field.
+  float                                 H_z;                                                         // Local transverse field.
+  float                                 kappa;                                                       // Concentration.
+  float                                 s_minus;                                                     // Envelope s - 1.
+  float                                 s_plus;                                                      // Envelope s + 1.
+  float                                 psi;                                                         // Deviation.
+  float                                 th;                                                          // Theta.
+  double                                sz;                                                          // z-spin summation.
+  double                                energy;                                                      // Energy summation.
+
+  // Theta of node "k" of the current path:
+  auto get = [&] (size_t k) {return loc_fixed ? sb::angle_decode (fixed[k]) : theta[k];};
+
+  // Neighbour local field of node "k":
+  auto field = [&] (size_t k)
+               {
+                 x = (int)(k%TEST_SIDE);                                                             // Getting node column...
+                 y = (int)(k/TEST_SIDE);                                                             // Getting node row...
+
+                 return TEST_C*(sin (get (y*TEST_SIDE + (x + 1)%TEST_SIDE)) +
+                                sin (get (y*TEST_SIDE + (x + TEST_SIDE - 1)%TEST_SIDE)) +
+                                sin (get (((y + 1)%TEST_SIDE)*TEST_SIDE + x)) +
+                                sin (get (((y + TEST_SIDE - 1)%TEST_SIDE)*TEST_SIDE + x)));          // Summating neighbours...
+               };
+
+  loc_sz.clear ();                                                                                   // Resetting z-spin statistics...
+  loc_energy.clear ();                                                                               // Resetting energy statistics...
+
+  for(s = 0; s < TEST_WARMUP + TEST_SWEEPS; s++)
+  {
+    // HEAT-BATH SWEEP (sequential, as the kernel draw):
+    for(n = 0; n < theta.size (); n++)
+    {
+      h     = field (n);                                                                             // Computing neighbour local field...
+      H_z   = TEST_HZ + h;                                                                           // Computing local transverse field...
+      kappa = sqrt (TEST_HX*TEST_HX + H_z*H_z)/TEST_T;                                               // Computing concentration...
+
+      if(sb::von_mises_envelope (kappa, &s_minus, &s_plus))
+      {
+        while(!sb::von_mises (kappa, s_minus, s_plus, 2.0f*(float)M_PI*flat (generator),
+                              flat (generator), &psi))
+        {
+        }
+
+        th = atan2 (H_z, TEST_HX) + psi;                                                             // Computing new theta...
+        th -= 2.0f*(float)M_PI*floor (th/(2.0f*(float)M_PI));                                        // Wrapping new theta...
+      }
+      else
+      {
+        th = 2.0f*(float)M_PI*flat (generator);                                                      // Drawing flat theta...
+      }
+
+      theta[n] = th;                                                                                 // Setting theta (float path)...
+      fixed[n] = sb::angle_encode (th);                                                              // Setting theta (16-bit path)...
+    }
+
+    if(s < TEST_WARMUP)
+    {
+      continue;
+    }
+
+    // MEASURING (energy as the reduction kernel, each pair counted once):
+    sz     = 0.0;                                                                                    // Resetting z-spin summation...
+    energy = 0.0;                                                                                    // Resetting energy summation...
+
+    for(n = 0; n < theta.size (); n++)
+    {
+      sz     += sin (get (n));                                                                       // Accumulating z-spin...
+      energy += -(TEST_HX*cos (get (n)) + (TEST_HZ + 0.5f*field (n))*sin (get (n)));                 // Accumulating energy...
+    }
+
+    loc_sz.add (sz/theta.size ());                                                                   // Adding z-spin sample...
+    loc_energy.add (energy/theta.size ());                                                           // Adding energy sample...
+  }
+}
+
+int main ()
+{
+  // INDICES:
+  size_t                                i;                                                           // Angle index [#].
+  size_t                                failed = 0;                                                  // Failed checks [#].
+
+  // ROUND TRIP:
+  std::mt19937                          generator (1234);                                            // Random generator (fixed seed).
+  std::uniform_real_distribution<float> turns (-4.0f*(float)M_PI, 4.0f*(float)M_PI);                 // Angles of several turns.
+  std::vector<float>                    angle (TEST_ANGLES);                                         // Angles [rad].
+  std::vector<float>                    expanded (TEST_ANGLES);                                      // Packed and expanded angles [rad].
+  std::vector<int>                      packed;                                                      // Packed angles.
+  double                                d;                                                           // Round trip deviation [rad].
+  double                                d_max = 0.0;                                                 // Maximum round trip deviation [rad].
+  size_t                                mismatch = 0;                                                // Packed transfer mismatches [#].
+
+  // LATTICE:
+  sb::statistics                        sz_float;                                                    // z-spin statistics (float path).
+  sb::statistics                        sz_fixed;                                                    // z-spin statistics (16-bit path).
+  sb::statistics                        energy_float;                                                // Energy statistics (float path).
+  sb::statistics                        energy_fixed;                                                // Energy statistics (16-bit path).
+  double                                error;                                                       // Standard error of the difference.
+
+  for(i = 0; i < angle.size (); i++)
+  {
+    angle[i] = turns (generator);                                                                    // Drawing angle...
+    d        = sb::angle_decode (sb::angle_encode (angle[i])) - (double)angle[i];                    // Computing round trip deviation...
+    d       -= 2.0*M_PI*floor (d/(2.0*M_PI) + 0.5);                                                  // Wrapping deviation in [-pi, pi)...
+    d_max    = fmax (d_max, fabs (d));                                                               // Updating maximum deviation...
+  }
+
+  sb::pack_angles (angle, packed);                                                                   // Packing angles...
+  sb::unpack_angles (packed, expanded);                                                              // Expanding angles...
+
+  for(i = 0; i < angle.size (); i++)
+  {
+    mismatch += (expanded[i] != sb::angle_decode (sb::angle_encode (angle[i]))) ? 1 : 0;             // Counting mismatch...
+  }
+
+  std::cout << "round trip: max deviation = " << d_max << " rad (half step " << M_PI/65536.0
+            << "), packed words = " << packed.size () << ", mismatches = " << mismatch;              // Printing message...
+
+  if(!(d_max <= TEST_ROUNDING*M_PI/65536.0) || (packed.size () != (TEST_ANGLES + 1)/2) ||
+     (mismatch != 0))
+  {
+    std::cout << " FAILED" << std::endl;                                                             // Printing message...
+    failed++;                                                                                        // Counting failure...
+  }
+  else
+  {
+    std::cout << " ok" << std::endl;                                                                 // Printing message...
+  }
+
+  run_lattice (false, 1234, sz_float, energy_float);                                                 // Running float path...
+  run_lattice (true, 5678, sz_fixed, energy_fixed);                                                  // Running 16-bit path...
+
+  error = sqrt (sz_float.error ()*sz_float.error () +
+                sz_fixed.error ()*sz_fixed.error ());                                                // Computing z-spin error...
+  std::cout << "<sz>: float = " << sz_float.mean () << ", 16-bit = " << sz_fixed.mean ()
+            << " +/- " << error;                                                                     // Printing message...
+
+  if(!(fabs (sz_float.mean () - sz_fixed.mean ()) <= TEST_SIGMAS*error))
+  {
+    std::cout << " FAILED" << std::endl;                                                             // Printing message...
+    failed++;                                                                                        // Counting failure...
+  }
+  else
+  {
+    std::cout << " ok" << std::endl;                                                                 // Printing message...
+  }
+
+  error = sqrt (energy_float.error ()*energy_float.error () +
+                energy_fixed.error ()*energy_fixed.error ());                                        // Computing energy error...
+  std::cout << "<E>: float = " << energy_float.mean () << ", 16-bit = " << energy_fixed.mean ()
+            << " +/- " << error;                                                                     // Printing message...
+
+  if(!(fabs (energy_float.mean () - energy_fixed.mean ()) <= TEST_SIGMAS*error))
+  {
+    std::cout << " FAILED" << std::endl;                                                             // Printing message...
+    failed++;                                                                                        // Counting failure...
+  }
+  else
+  {
+    std::cout << " ok" << std::endl;                                                                 // Printing message...
+  }
+
+  return (failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,91 @@
+/// @file     heatbath.cpp
+/// @date     16OCT2026
+/// @brief    Heat-bath (von Mises) draw test.
+/// @details  Draws TEST_DRAWS deviations with the kernel code (heatbath.cl, see heatbath.hpp) for a
+/// range of concentrations and checks the mean <cos(psi)> against the exact von Mises value
+/// I1(kappa)/I0(kappa), within TEST_SIGMAS standard errors, and the Best-Fisher acceptance against
+/// its 65% lower bound. Below the flat draw threshold the kernels take the flat angle as it is.
+
+// INCLUDES:
+#include "heatbath.hpp"                                                                              // Heat-bath draw.
+
+#include <iostream>
+#include <random>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#define TEST_DRAWS      1000000                                                                      // Accepted draws per concentration.
+#define TEST_SIGMAS     5.0                                                                          // Tolerance [standard errors].
+#define TEST_ACCEPTANCE 0.65                                                                         // Minimum acceptance (Best-Fisher bound).
+
+int main ()
+{
+  // INDICES:
+  size_t                                k;                                                           // Concentration index [#].
+  size_t                                draws;                                                       // Accepted draws [#].
+  size_t                                iterations;                                                  // Draw iterations [#].
+  size_t                                failed = 0;                                                  // Failed checks [#].
+
+  // DRAW:
+  std::mt19937                          generator (1234);                                            // Random generator (fixed seed).
+  std::uniform_real_distribution<float> flat (0.0f, 1.0f);                                           // Flat distribution in [0, 1).
+  std::vector<float>                    kappa = {0.0f, 0.1f, 1.0f, 10.0f, 100.0f, 500.0f};           // Concentrations.
+  float                                 psi;                                                         // Deviation.
+  float                                 theta_rand;                                                  // Flat random theta.
+  float                                 s_minus;                                                     // Envelope s - 1.
+  float                                 s_plus;                                                      // Envelope s + 1.
+  bool                                  envelope;                                                    // "false" = flat draw.
+  double                                sum;                                                         // cos(psi) summation.
+  double                                sum2;                                                        // cos(psi) square summation.
+
+  // CHECK:
+  double                                mean;                                                        // <cos(psi)>.
+  double                                error;                                                       // <cos(psi)> standard error.
+  double                                exact;                                                       // I1(kappa)/I0(kappa).
+  double                                acceptance;                                                  // Acceptance.
+
+  for(k = 0; k < kappa.size (); k++)
+  {
+    draws      = 0;                                                                                  // Resetting accepted draws...
+    iterations = 0;                                                                                  // Resetting draw iterations...
+    sum        = 0.0;                                                                                // Resetting summation...
+    sum2       = 0.0;                                                                                // Resetting square summation...
+    envelope   = sb::von_mises_envelope (kappa[k], &s_minus, &s_plus);                               // Setting envelope...
+
+    while(draws < TEST_DRAWS)
+    {
+      iterations++;                                                                                  // Counting iteration...
+      theta_rand = 2.0f*(float)M_PI*flat (generator);                                                // Drawing flat theta...
+      psi        = theta_rand;                                                                       // Setting deviation (flat draw)...
+
+      if(!envelope || sb::von_mises (kappa[k], s_minus, s_plus, theta_rand, flat (generator), &psi))
+      {
+        sum  += cos (psi);                                                                           // Accumulating cos(psi)...
+        sum2 += cos (psi)*cos (psi);                                                                 // Accumulating cos(psi) square...
+        draws++;                                                                                     // Counting draw...
+      }
+    }
+
+    mean       = sum/draws;                                                                          // Computing <cos(psi)>...
+    error      = sqrt (fmax (sum2/draws - mean*mean, 0.0)/(draws - 1.0));                            // Computing standard error...
+    exact      = !envelope ? 0.0 :
+                 std::cyl_bessel_i (1.0, (double)kappa[k])/std::cyl_bessel_i (0.0, (double)kappa[k]); // Computing exact value...
+    acceptance = (double)draws/iterations;                                                           // Computing acceptance...
+
+    std::cout << "kappa = " << kappa[k] << ": <cos(psi)> = " << mean << " +/- " << error
+              << ", I1/I0 = " << exact << ", acceptance = " << acceptance;                           // Printing message...
+
+    if(!(fabs (mean - exact) <= TEST_SIGMAS*error + 1.0e-6) || (acceptance < TEST_ACCEPTANCE))
+    {
+      std::cout << " FAILED" << std::endl;                                                           // Printing message...
+      failed++;                                                                                      // Counting failure...
+    }
+    else
+    {
+      std::cout << " ok" << std::endl;                                                               // Printing message...
+    }
+  }
+
+  return (failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
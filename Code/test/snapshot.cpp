@@ -0,0 +1,158 @@
+/// @file     snapshot.cpp
+/// @date     16OCT2026
+/// @brief    Snapshot file test.
+/// @details  Writes TEST_RECORDS records of random fields with sb::snapshot_writer, with and without
+/// random generator state, reads them back with sb::snapshot_reader and checks that the mesh block,
+/// the record headers, theta and the generator states are restored bit for bit.
+
+// INCLUDES:
+#include "snapshot.hpp"                                                                              // Snapshot files.
+
+#include <iostream>
+#include <random>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+
+#define TEST_NODES   1000                                                                            // Number of nodes.
+#define TEST_RECORDS 3                                                                               // Records per file.
+#define TEST_FILE    "spin_bubble_test.snap"                                                         // Test file name (in the temporary directory).
+
+int main ()
+{
+  // INDICES:
+  size_t                                i;                                                           // Node index [#].
+  size_t                                r;                                                           // Record index [#].
+  size_t                                s;                                                           // RNG mode index [#].
+  size_t                                failed = 0;                                                  // Failed checks [#].
+
+  // MESH:
+  std::mt19937                          generator (1234);                                            // Random generator (fixed seed).
+  std::uniform_real_distribution<float> flat (0.0f, 1.0f);                                           // Flat distribution in [0, 1).
+  std::vector<int>                      index (TEST_NODES);                                          // Node indices.
+  std::vector<float>                    x (TEST_NODES);                                              // Node "x" coordinates.
+  std::vector<float>                    y (TEST_NODES);                                              // Node "y" coordinates.
+  std::vector<int>                      neighbour = {1, 0};                                          // CSR neighbour indices.
+  std::vector<int>                      offset    = {1, 2};                                          // CSR neighbour offsets.
+  uint64_t                              hash;                                                        // Mesh hash.
+
+  // FIELDS:
+  std::vector<float>                    parameter (SNAPSHOT_PARAMETERS + 4);                         // Parameters (more than stored).
+  std::vector<std::vector<float> >      theta (TEST_RECORDS);                                        // Theta, per record.
+  std::vector<std::vector<int> >        rng_theta (TEST_RECORDS);                                    // Random generator state (theta), per record.
+  std::vector<std::vector<int> >        rng_threshold (TEST_RECORDS);                                // Random generator state (threshold), per record.
+  std::string                           file_name;                                                   // Test file name.
+  sb::snapshot_writer                   writer;                                                      // Snapshot writer.
+  sb::snapshot_reader                   reader;                                                      // Snapshot reader.
+  const sb::snapshot_record_header*     record;                                                      // Record header.
+  bool                                  rng;                                                         // "true" = store random generator state.
+  bool                                  ok;                                                          // Check result.
+
+  file_name = (std::filesystem::temp_directory_path ()/TEST_FILE).string ();                         // Setting test file name...
+
+  for(i = 0; i < TEST_NODES; i++)
+  {
+    index[i] = (int)(TEST_NODES - 1 - i);                                                            // Setting node index...
+    x[i]     = flat (generator);                                                                     // Setting node "x" coordinate...
+    y[i]     = flat (generator);                                                                     // Setting node "y" coordinate...
+  }
+
+  for(i = 0; i < parameter.size (); i++)
+  {
+    parameter[i] = flat (generator);                                                                 // Setting parameter...
+  }
+
+  for(r = 0; r < TEST_RECORDS; r++)
+  {
+    theta[r].resize (TEST_NODES);                                                                    // Sizing theta...
+    rng_theta[r].resize (TEST_NODES*SNAPSHOT_RNG/2);                                                 // Sizing random generator state (theta)...
+    rng_threshold[r].resize (TEST_NODES*SNAPSHOT_RNG/2);                                             // Sizing random generator state (threshold)...
+
+    for(i = 0; i < TEST_NODES; i++)
+    {
+      theta[r][i] = 6.2831853f*flat (generator);                                                     // Setting theta...
+    }
+
+    for(i = 0; i < TEST_NODES*SNAPSHOT_RNG/2; i++)
+    {
+      rng_theta[r][i]     = (int)generator ();                                                       // Setting random generator state (theta)...
+      rng_threshold[r][i] = (int)generator ();                                                       // Setting random generator state (threshold)...
+    }
+  }
+
+  hash = sb::mesh_hash (x, y, neighbour, offset);                                                    // Computing mesh hash...
+
+  for(s = 0; s < 2; s++)
+  {
+    rng = (s == 0);                                                                                  // Setting RNG mode...
+
+    // WRITING SNAPSHOT FILE:
+    writer.open (file_name, hash, index, x, y, rng);                                                 // Opening snapshot file...
+
+    for(r = 0; r < TEST_RECORDS; r++)
+    {
+      writer.write (
+                    1000 + r,
+                    (uint32_t)r,
+                    (uint32_t)(2*r + 1),
+                    parameter,
+                    theta[r].data (),
+                    rng_theta[r].data (),
+                    rng_threshold[r].data ()
+                   );                                                                                // Writing record...
+    }
+
+    writer.close ();                                                                                 // Closing snapshot file...
+
+    // READING SNAPSHOT FILE:
+    ok = reader.open (file_name) && sb::is_snapshot (file_name) &&
+         (reader.nodes () == TEST_NODES) && (reader.mesh_hash () == hash) &&
+         (reader.has_rng () == rng) && (reader.records () == TEST_RECORDS) &&
+         (std::memcmp (reader.index (), index.data (), TEST_NODES*sizeof (int)) == 0) &&
+         (std::memcmp (reader.x (), x.data (), TEST_NODES*sizeof (float)) == 0) &&
+         (std::memcmp (reader.y (), y.data (), TEST_NODES*sizeof (float)) == 0);                     // Checking file header and mesh block...
+
+    for(r = 0; ok && (r < TEST_RECORDS); r++)
+    {
+      record = reader.record (r);                                                                    // Getting record header...
+      ok     = (record->step == 1000 + r) && (record->trial == r) && (record->replica == 2*r + 1) &&
+               (std::memcmp (record->parameter, parameter.data (), sizeof (record->parameter)) == 0) &&
+               (std::memcmp (reader.theta (r), theta[r].data (), TEST_NODES*sizeof (float)) == 0);   // Checking record header and theta...
+
+      if(ok && rng)
+      {
+        ok = (std::memcmp (reader.rng (r), rng_theta[r].data (), rng_theta[r].size ()*sizeof (int)) == 0) &&
+             (std::memcmp (
+                           reader.rng (r) + rng_theta[r].size (),
+                           rng_threshold[r].data (),
+                           rng_threshold[r].size ()*sizeof (int)
+                          ) == 0);                                                                   // Checking random generator state...
+      }
+    }
+
+    reader.close ();                                                                                 // Closing snapshot file...
+    std::remove (file_name.c_str ());                                                                // Removing test file...
+
+    std::cout << "rng = " << rng << ": " << TEST_RECORDS << " records of " << TEST_NODES << " nodes"
+              << (ok ? " ok" : " FAILED") << std::endl;                                              // Printing message...
+
+    if(!ok)
+    {
+      failed++;                                                                                      // Counting failure...
+    }
+  }
+
+  // CHECKING MESH HASH:
+  x[0] = x[0] + 1.0f;                                                                                // Moving one node...
+
+  if(sb::mesh_hash (x, y, neighbour, offset) == hash)
+  {
+    std::cout << "mesh hash unchanged by a moved node FAILED" << std::endl;                          // Printing message...
+    failed++;                                                                                        // Counting failure...
+  }
+
+  return (failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,73 @@
+/// @file     statistics.cpp
+/// @date     16OCT2026
+/// @brief    Blocking statistics test.
+/// @details  Feeds TEST_SAMPLES samples of AR(1) series x' = phi*x + noise (unit Gaussian noise) to
+/// sb::statistics and checks the blocked analysis against the exact values: integrated
+/// autocorrelation time tau = 0.5*(1 + phi)/(1 - phi), standard error of the mean
+/// sqrt(2*tau/(n*(1 - phi^2))), both within TEST_TOLERANCE, and a mean within TEST_SIGMAS errors.
+
+// INCLUDES:
+#include "statistics.hpp"                                                                            // Streaming statistics.
+
+#include <iostream>
+#include <random>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#define TEST_SAMPLES   1048576                                                                       // Samples per series.
+#define TEST_TOLERANCE 0.15                                                                          // Relative tolerance on tau and on the error.
+#define TEST_SIGMAS    5.0                                                                           // Tolerance on the mean [standard errors].
+
+int main ()
+{
+  // INDICES:
+  size_t                                k;                                                           // Series index [#].
+  size_t                                i;                                                           // Sample index [#].
+  size_t                                failed = 0;                                                  // Failed checks [#].
+
+  // SERIES:
+  std::mt19937_64                       generator (1234);                                            // Random generator (fixed seed).
+  std::normal_distribution<double>      noise (0.0, 1.0);                                            // Unit Gaussian noise.
+  std::vector<double>                   phi = {0.0, 0.5, 0.9};                                       // Autoregression coefficients.
+  sb::statistics                        stat;                                                        // Streaming statistics.
+  double                                x;                                                           // Series value.
+
+  // CHECK:
+  double                                tau;                                                         // Exact autocorrelation time.
+  double                                error;                                                       // Exact standard error of the mean.
+
+  for(k = 0; k < phi.size (); k++)
+  {
+    stat.clear ();                                                                                   // Resetting statistics...
+    x = noise (generator)/sqrt (1.0 - phi[k]*phi[k]);                                                // Drawing stationary start...
+
+    for(i = 0; i < TEST_SAMPLES; i++)
+    {
+      stat.add (x);                                                                                  // Adding sample...
+      x = phi[k]*x + noise (generator);                                                              // Updating series...
+    }
+
+    tau   = 0.5*(1.0 + phi[k])/(1.0 - phi[k]);                                                      // Computing exact tau...
+    error = sqrt (2.0*tau/(TEST_SAMPLES*(1.0 - phi[k]*phi[k])));                                     // Computing exact error...
+
+    std::cout << "phi = " << phi[k] << ": mean = " << stat.mean () << " +/- " << stat.error ()
+              << " (exact error " << error << "), tau = " << stat.tau () << " (exact " << tau
+              << "), plateau = " << stat.plateau ();                                                 // Printing message...
+
+    if(!stat.plateau () ||
+       !(fabs (stat.tau () - tau) <= TEST_TOLERANCE*tau) ||
+       !(fabs (stat.error () - error) <= TEST_TOLERANCE*error) ||
+       !(fabs (stat.mean ()) <= TEST_SIGMAS*error))
+    {
+      std::cout << " FAILED" << std::endl;                                                           // Printing message...
+      failed++;                                                                                      // Counting failure...
+    }
+    else
+    {
+      std::cout << " ok" << std::endl;                                                               // Printing message...
+    }
+  }
+
+  return (failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,57 @@
+/// @file     angle.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of the 16-bit fixed-point angles.
+/// @details  The device stores theta as a 16-bit fixed-point fraction of a turn, two angles per
+/// 32-bit word of an int buffer (theta, theta_int), and the rejection sampling iterations as 16-bit
+/// counts in the same layout (m_overflow, hence m_max <= ANGLE_COUNT_MAX). The host keeps theta in
+/// float and converts it at every transfer, so that snapshots, checkpoints and halo exchanges carry
+/// float angles. The encoder and decoder are defined in Code/kernel/angle.cl, which angle.cpp
+/// compiles as C++: the host runs the kernel code itself. Packed words use the host byte order,
+/// which is the device byte order on all supported platforms.
+#ifndef angle_hpp
+#define angle_hpp
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#define ANGLE_COUNT_MAX 65535                                                                        // Largest 16-bit count (m_max bound).
+
+namespace sb
+{
+typedef uint16_t ushort;                                                                             ///< OpenCL C "ushort".
+
+/// @brief **Angle encoder.**
+/// @details Nearest 16-bit fixed-point step of "loc_theta" [rad], of any turn.
+ushort angle_encode (
+                     float  loc_theta                                                                ///< Theta [rad].
+                    );
+
+/// @brief **Angle decoder.**
+/// @details Theta [rad] in [0, 2pi) of the fixed-point angle "loc_a".
+float  angle_decode (
+                     ushort loc_a                                                                    ///< Fixed-point angle.
+                    );
+
+/// @brief **Packed size.**
+/// @details Number of 32-bit words holding "loc_size" 16-bit values.
+size_t packed_size (
+                    size_t loc_size                                                                  ///< Number of values [#].
+                   );
+
+/// @brief **Angle packer.**
+/// @details Encodes all angles of "loc_theta" into "loc_packed" (resized to the packed size).
+void   pack_angles (
+                    const std::vector<float>& loc_theta,                                             ///< Theta [rad].
+                    std::vector<int>&         loc_packed                                             ///< Packed angles.
+                   );
+
+/// @brief **Angle unpacker.**
+/// @details Decodes the first "loc_theta.size ()" angles of "loc_packed" into "loc_theta".
+void   unpack_angles (
+                      const std::vector<int>& loc_packed,                                            ///< Packed angles.
+                      std::vector<float>&     loc_theta                                              ///< Theta [rad].
+                     );
+}
+
+#endif
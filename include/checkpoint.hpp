@@ -0,0 +1,73 @@
+/// @file     checkpoint.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of a "checkpoint" class.
+/// @details  A checkpoint is a set of named binary sections (device buffers, host counters, parameters)
+/// saved to a single file, so that a run can be resumed bit-for-bit. The file is written to a temporary
+/// file first and then renamed, so that a preemption while saving never leaves a broken checkpoint.
+/// Data are stored in the native byte order.
+#ifndef checkpoint_hpp
+#define checkpoint_hpp
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstddef>
+
+#define CHECKPOINT_MAGIC   "SBCKPT"                                                                  // Checkpoint file magic string.
+#define CHECKPOINT_VERSION 2                                                                         // Checkpoint file format version.
+
+namespace sb
+{
+class checkpoint                                                                                     /// @brief **Checkpoint.**
+{
+private:
+  std::map<std::string, std::vector<char> > section;                                                 ///< Named sections.
+
+public:
+  checkpoint ();
+
+  /// @brief **Section setter.**
+  /// @details Copies "loc_size" bytes into the named section (replacing it if already present).
+  void   set (
+              std::string loc_key,                                                                   ///< Section name.
+              const void* loc_data,                                                                  ///< Section data.
+              size_t      loc_size                                                                   ///< Section size [bytes].
+             );
+
+  /// @brief **Section getter.**
+  /// @details Copies the named section into "loc_data". Exits if the section is missing or if its size
+  /// is not "loc_size" bytes (the checkpoint does not match the current run).
+  void   get (
+              std::string loc_key,                                                                   ///< Section name.
+              void*       loc_data,                                                                  ///< Section data.
+              size_t      loc_size                                                                   ///< Section size [bytes].
+             );
+
+  bool   has (
+              std::string loc_key                                                                    ///< Section name.
+             );
+
+  size_t size (
+               std::string loc_key                                                                   ///< Section name.
+              );
+
+  /// @brief **Checkpoint writer.**
+  /// @details Writes all sections to "loc_file_name" (through a temporary file and a rename).
+  void   save (
+               std::string loc_file_name                                                             ///< File name.
+              );
+
+  /// @brief **Checkpoint reader.**
+  /// @details Reads all sections from "loc_file_name". Returns "false" if the file cannot be opened.
+  /// Exits on malformed files.
+  bool   load (
+               std::string loc_file_name                                                             ///< File name.
+              );
+
+  void   clear ();
+
+  ~checkpoint ();
+};
+}
+
+#endif
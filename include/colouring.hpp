@@ -0,0 +1,34 @@
+/// @file     colouring.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of the graph colouring functions.
+/// @details  A colouring of the mesh graph assigns different colours to neighbour nodes: all nodes of a
+/// colour can then be updated in place at the same time (sequential Metropolis sweep, one kernel launch
+/// per colour).
+#ifndef colouring_hpp
+#define colouring_hpp
+
+#include <vector>
+#include <cstddef>
+
+namespace sb
+{
+/// @brief **Greedy graph colouring.**
+/// @details Assigns to each node the smallest colour not used by its neighbours, visiting nodes in
+/// index order. Returns the colour of each node.
+std::vector<int> colour (
+                         const std::vector<int>& loc_neighbour,                                      ///< CSR neighbour indices.
+                         const std::vector<int>& loc_offset                                          ///< CSR neighbour offsets.
+                        );
+
+/// @brief **Colour classes.**
+/// @details Sorts nodes by colour: on return "loc_node" lists the nodes of colour 0, then those of
+/// colour 1 and so on, while "loc_class_offset[c]" is the end of class "c" in "loc_node" (CSR style).
+/// Returns the size of the largest class.
+size_t           colour_classes (
+                                 const std::vector<int>& loc_colour,                                 ///< Node colours.
+                                 std::vector<int>&       loc_node,                                   ///< Nodes sorted by colour.
+                                 std::vector<int>&       loc_class_offset                            ///< Colour class offsets.
+                                );
+}
+
+#endif
@@ -0,0 +1,30 @@
+/// @file     compact.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of the compact storage functions.
+/// @details  Compact neighbour indices for very large meshes: each CSR entry stores the offset of the
+/// neighbour from its node, modulo the number of nodes, as a 16-bit integer (two entries per "int" of
+/// the neighbour buffer, read as "short" by the kernels, see metropolis.cl). On a periodic grid in row
+/// order (or after a bandwidth-reducing reordering, see reorder.hpp) the offsets are bounded by about
+/// one grid row, whatever the number of nodes: the neighbour buffer is halved and the indices stay exact.
+#ifndef compact_hpp
+#define compact_hpp
+
+#include <vector>
+#include <cstddef>
+
+namespace sb
+{
+/// @brief **Neighbour index narrowing.**
+/// @details Packs the CSR neighbour indices of the rows of nodes "loc_first", "loc_first + 1", ...
+/// as 16-bit offsets modulo "loc_nodes" into "loc_packed". Returns "false" (leaving "loc_packed"
+/// untouched) when an offset does not fit in 16 bits.
+bool narrow_neighbours (
+                        const std::vector<int>& loc_neighbour,                                       ///< CSR neighbour indices.
+                        const std::vector<int>& loc_offset,                                          ///< CSR neighbour offsets.
+                        size_t                  loc_first,                                           ///< Node of the first CSR row.
+                        size_t                  loc_nodes,                                           ///< Number of nodes.
+                        std::vector<int>&       loc_packed                                           ///< Packed neighbour offsets.
+                       );
+}
+
+#endif
@@ -0,0 +1,86 @@
+/// @file     config.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of a "config" class.
+/// @details  Run configuration made of "key = value" entries, read from a configuration file and/or
+/// from the command line ("--key value" or "--key=value"). Command line entries override file entries.
+#ifndef config_hpp
+#define config_hpp
+
+#include <string>
+#include <map>
+#include <vector>
+
+namespace sb
+{
+class config                                                                                         /// @brief **Run configuration.**
+{
+private:
+  std::map<std::string, std::string> entry;                                                          ///< Configuration entries.
+
+public:
+  config ();
+
+  /// @brief **Configuration file reader.**
+  /// @details Reads "key = value" lines from a text file. Everything after a '#' is a comment.
+  void        read (
+                    std::string loc_file_name                                                        ///< Configuration file name.
+                   );
+
+  /// @brief **Command line parser.**
+  /// @details Parses "--key value" and "--key=value" arguments. A "--config file" argument is read
+  /// first, so that the remaining command line arguments override its entries.
+  void        parse (
+                     int    loc_argc,                                                                ///< Number of arguments.
+                     char** loc_argv                                                                 ///< Arguments.
+                    );
+
+  void        set (
+                   std::string loc_key,                                                              ///< Entry key.
+                   std::string loc_value                                                             ///< Entry value.
+                  );
+
+  bool        has (
+                   std::string loc_key                                                               ///< Entry key.
+                  );
+
+  float       get (
+                   std::string loc_key,                                                              ///< Entry key.
+                   float       loc_default                                                           ///< Default value.
+                  );
+
+  int         get (
+                   std::string loc_key,                                                              ///< Entry key.
+                   int         loc_default                                                           ///< Default value.
+                  );
+
+  bool        get (
+                   std::string loc_key,                                                              ///< Entry key.
+                   bool        loc_default                                                           ///< Default value.
+                  );
+
+  std::string get (
+                   std::string loc_key,                                                              ///< Entry key.
+                   std::string loc_default                                                           ///< Default value.
+                  );
+
+  std::string get (
+                   std::string loc_key,                                                              ///< Entry key.
+                   const char* loc_default                                                           ///< Default value.
+                  );
+
+  /// @brief **List getter.**
+  /// @details Splits a comma-separated entry ("a, b, c") into its trimmed items.
+  std::vector<std::string> list (
+                                 std::string loc_key,                                                ///< Entry key.
+                                 std::string loc_default                                             ///< Default value.
+                                );
+
+  /// @brief **Configuration printer.**
+  /// @details Prints all entries, for the record.
+  void        print ();
+
+  ~config ();
+};
+}
+
+#endif
@@ -0,0 +1,44 @@
+/// @file     coupling.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of the coupling table functions.
+/// @details  The radial coupling C = 0.5/(L/ds)^alpha depends only on the (static) mesh geometry and on
+/// the radial exponent: it is tabulated per CSR edge, in the same order of the "neighbour" array, and
+/// rebuilt only when alpha changes.
+#ifndef coupling_hpp
+#define coupling_hpp
+
+#include <vector>
+#include <cstddef>
+
+namespace sb
+{
+/// @brief **Periodic domain length.**
+/// @details Computes the period of a direction of a periodic lattice from the node coordinates along it:
+/// the period is the coordinate extent plus one lattice spacing.
+float              period (
+                           const std::vector<float>& loc_coordinate,                                 ///< Node coordinates along the direction.
+                           size_t                    loc_side_nodes                                  ///< Number of nodes along the direction.
+                          );
+
+/// @brief **Edge lengths.**
+/// @details Computes the length of each CSR edge using the minimum image convention on a periodic
+/// domain of size period_x x period_y (no float equality tests on the wrapped links).
+std::vector<float> edge_length (
+                                const std::vector<float>& loc_x,                                     ///< Node "x" coordinates.
+                                const std::vector<float>& loc_y,                                     ///< Node "y" coordinates.
+                                const std::vector<int>&   loc_neighbour,                             ///< CSR neighbour indices.
+                                const std::vector<int>&   loc_offset,                                ///< CSR neighbour offsets.
+                                float                     loc_period_x,                              ///< Period along "x".
+                                float                     loc_period_y                               ///< Period along "y".
+                               );
+
+/// @brief **Coupling table.**
+/// @details Computes the radial coupling 0.5/(L/ds)^alpha for each edge length L.
+std::vector<float> coupling (
+                             const std::vector<float>& loc_length,                                   ///< Edge lengths.
+                             float                     loc_ds,                                       ///< Simulation space step.
+                             float                     loc_alpha                                     ///< Radial exponent.
+                            );
+}
+
+#endif
@@ -0,0 +1,124 @@
+/// @file     halo.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of a "halo" class.
+/// @details  Halo exchange between the processes of a multi-device run (one process and one OpenCL
+/// context per device, each owning a partition of the mesh, see partition.hpp). The processes share a
+/// memory-mapped file holding a global copy of theta and one reduction slot per partition: after each
+/// sweep every process publishes the theta of its boundary nodes, waits for the others and gathers
+/// the theta of its ghost nodes, both packed in a small device buffer (see partition.hpp); at every
+/// readback the observables are summed over all partitions, and before a download the whole owned
+/// theta is published. Both areas are double buffered, so one barrier per exchange is enough. A
+/// partition that waits more than HALO_TIMEOUT seconds at a barrier (a peer crashed or hung) poisons
+/// the shared file, so that all partitions stop with an error instead of spinning forever. Linux only
+/// (POSIX shared memory).
+#ifndef halo_hpp
+#define halo_hpp
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#define HALO_MAGIC   "SBHALO"                                                                        // Halo file magic string.
+#define HALO_FILE    "/dev/shm/spin-bubble-halo"                                                     // Default halo file name.
+#define HALO_TIMEOUT 600                                                                             // Maximum wait for the first partition and at a barrier [s].
+
+namespace sb
+{
+class halo                                                                                           /// @brief **Halo exchange.**
+{
+private:
+  std::string file;                                                                                  ///< Halo file name.
+  char*       base;                                                                                  ///< Mapped file.
+  size_t      size;                                                                                  ///< Mapped file size [bytes].
+  size_t      parts;                                                                                 ///< Number of partitions.
+  size_t      part;                                                                                  ///< Partition index.
+  size_t      values;                                                                                ///< Global values (nodes x replicas).
+  size_t      reduction;                                                                             ///< Reduction values per partition.
+  uint32_t    sense;                                                                                 ///< Barrier sense.
+  size_t      value_parity;                                                                          ///< Current global values buffer.
+  size_t      reduction_parity;                                                                      ///< Current reduction buffer.
+
+  void   barrier ();                                                                                 // Waiting for all partitions (exits on timeout or abort).
+  float* value_buffer (
+                       size_t loc_parity                                                             // Buffer parity.
+                      );
+  float* reduction_buffer (
+                           size_t loc_parity,                                                        // Buffer parity.
+                           size_t loc_part                                                           // Partition index.
+                          );
+
+public:
+  halo ();
+
+  /// @brief **Halo opener.**
+  /// @details Partition 0 creates the halo file (replacing any stale one), the others wait for it and
+  /// check that it belongs to the same run ("loc_key", e.g. mesh hash and seed). Returns "false" if the
+  /// file cannot be created or mapped, or if shared memory is not supported.
+  bool         open (
+                     std::string loc_file_name,                                                      ///< Halo file name.
+                     uint64_t    loc_key,                                                            ///< Run key.
+                     size_t      loc_parts,                                                          ///< Number of partitions.
+                     size_t      loc_part,                                                           ///< Partition index.
+                     size_t      loc_values,                                                         ///< Global values (nodes x replicas).
+                     size_t      loc_reduction                                                       ///< Reduction values per partition.
+                    );
+
+  /// @brief **Halo exchange.**
+  /// @details "loc_packed" holds the boundary theta of all replicas ("loc_boundary" nodes, replica
+  /// after replica), followed by the ghost theta of all replicas ("loc_ghost" nodes). Publishes the
+  /// boundary theta, waits for all partitions and gathers the ghost theta into "loc_packed".
+  void         exchange (
+                         float*                  loc_packed,                                         ///< Packed halo values.
+                         size_t                  loc_nodes,                                          ///< Number of nodes (all partitions).
+                         const std::vector<int>& loc_boundary,                                       ///< Boundary nodes.
+                         const std::vector<int>& loc_ghost                                           ///< Ghost nodes.
+                        );
+
+  /// @brief **Owned values publisher.**
+  /// @details Publishes the owned nodes [loc_begin, loc_end) of all replica slices of "loc_data"
+  /// (slices of "loc_slice" values starting with the owned nodes) and waits for all partitions.
+  void         publish (
+                        const float*            loc_data,                                            ///< Theta (all replica slices).
+                        size_t                  loc_slice,                                           ///< Slice size.
+                        size_t                  loc_nodes,                                           ///< Number of nodes (all partitions).
+                        size_t                  loc_begin,                                           ///< First owned node.
+                        size_t                  loc_end                                              ///< Last owned node + 1.
+                       );
+
+  /// @brief **Global values.**
+  /// @details Returns the global theta (all partitions) of the last publish.
+  const float* global ();
+
+  /// @brief **Global reduction.**
+  /// @details Replaces the "reduction" values of "loc_data" with their sum over all partitions.
+  void         reduce (
+                       float* loc_data                                                               ///< Partition values.
+                      );
+
+  /// @brief **Halo abort.**
+  /// @details Poisons the halo file: the other partitions stop with an error at their next barrier.
+  /// To be called by a partition that exits with an error after opening the file.
+  void         abort ();
+
+  /// @brief **Halo closer.**
+  /// @details Unmaps the halo file; the last partition to leave removes it.
+  void         close ();
+
+  ~halo ();
+};
+
+/// @brief **Partition device binder.**
+/// @details Neutrino creates its OpenCL context on the first device of the requested type, so each
+/// partition process is bound to its own device through the visible-devices variables of the vendor
+/// runtimes (CUDA_VISIBLE_DEVICES, ROCR_VISIBLE_DEVICES, GPU_DEVICE_ORDINAL, ZE_AFFINITY_MASK), set
+/// to the device index of the partition before the context is created. Variables already set in the
+/// environment are kept. An empty list leaves the runtime default. Returns "false" if the list has no
+/// device index for the partition.
+bool bind_device (
+                  const std::vector<std::string>& loc_device,                                        ///< Device indices (one per partition).
+                  size_t                          loc_part                                           ///< Partition index.
+                 );
+}
+
+#endif
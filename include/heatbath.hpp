@@ -0,0 +1,38 @@
+/// @file     heatbath.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of the heat-bath (von Mises) draw.
+/// @details  The single-site conditional distribution of theta is a von Mises distribution:
+/// p(theta) ~ exp(kappa*cos(theta - phi)), with phi the direction of the local field (Hx, Hz + h) and
+/// kappa = |(Hx, Hz + h)|/T. The kernels draw it exactly with the Best-Fisher algorithm (rejection
+/// from a wrapped Cauchy envelope, acceptance above 65% for any kappa): each iteration takes a flat
+/// angle and a flat threshold, like one rejection sampling iteration. The functions are defined in
+/// Code/kernel/heatbath.cl, which heatbath.cpp compiles as C++: the host runs the kernel code itself.
+#ifndef heatbath_hpp
+#define heatbath_hpp
+
+namespace sb
+{
+/// @brief **Von Mises envelope.**
+/// @details Sets the wrapped Cauchy envelope s - 1 and s + 1 for concentration "loc_kappa". Returns
+/// "false" below the flat draw threshold (the density is flat within float precision).
+bool von_mises_envelope (
+                         float  loc_kappa,                                                           ///< Concentration.
+                         float* loc_s_minus,                                                         ///< Envelope s - 1.
+                         float* loc_s_plus                                                           ///< Envelope s + 1.
+                        );
+
+/// @brief **Von Mises iteration.**
+/// @details One Best-Fisher iteration for concentration "loc_kappa", from a flat angle in [0, 2pi)
+/// and a flat threshold in [0, 1]. Returns "true" if the candidate is accepted, then sets the
+/// deviation "loc_psi" from the local field direction, in [-pi, pi].
+bool von_mises (
+                float  loc_kappa,                                                                    ///< Concentration.
+                float  loc_s_minus,                                                                  ///< Envelope s - 1.
+                float  loc_s_plus,                                                                   ///< Envelope s + 1.
+                float  loc_theta_rand,                                                               ///< Flat random theta.
+                float  loc_threshold_rand,                                                           ///< Flat random threshold.
+                float* loc_psi                                                                       ///< Deviation.
+               );
+}
+
+#endif
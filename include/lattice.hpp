@@ -0,0 +1,51 @@
+/// @file     lattice.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of a "lattice" class.
+/// @details  Native generator of periodic square (or rectangular) lattices: builds node positions, CSR
+/// topology and per-edge lengths directly, in O(N) time and memory, with no GMSH mesh file. Nodes are
+/// numbered row by row (node = row*side_x_nodes + column); each node links to its 4 nearest neighbours
+/// (+x, -x, +y, -y) and, with the 8-neighbour stencil, also to its 4 diagonal neighbours, wrapping
+/// around the periodic boundaries.
+#ifndef lattice_hpp
+#define lattice_hpp
+
+#include <vector>
+#include <cstddef>
+
+namespace sb
+{
+class lattice                                                                                        /// @brief **Periodic lattice.**
+{
+public:
+  std::vector<int>   node;                                                                           ///< Node indices.
+  std::vector<float> x;                                                                              ///< Node "x" coordinates.
+  std::vector<float> y;                                                                              ///< Node "y" coordinates.
+  std::vector<int>   neighbour;                                                                      ///< CSR neighbour indices.
+  std::vector<int>   offset;                                                                         ///< CSR neighbour offsets (end of each node stride).
+  std::vector<float> length;                                                                         ///< Edge lengths (same order of "neighbour").
+  size_t             side_x_nodes;                                                                   ///< Number of nodes along "x" (row length).
+  size_t             side_y_nodes;                                                                   ///< Number of nodes along "y" (number of rows).
+  float              ds;                                                                             ///< Lattice spacing.
+
+  /// @brief **Class constructor.**
+  lattice ();
+
+  /// @brief **Lattice generator.**
+  /// @details Generates a periodic lattice of "loc_side_x_nodes" x "loc_side_y_nodes" nodes with
+  /// spacing 2/(loc_side_x_nodes - 1): "x" spans [-1, +1] and "y" is centred on 0. The stencil is
+  /// either 4 (nearest neighbours) or 8 (nearest and diagonal neighbours); both sides must have at
+  /// least 3 nodes, so that all links of a node are distinct.
+  void generate (
+                 size_t loc_side_x_nodes,                                                            ///< Number of nodes along "x".
+                 size_t loc_side_y_nodes,                                                            ///< Number of nodes along "y".
+                 size_t loc_stencil                                                                  ///< Neighbours per node (4 or 8).
+                );
+
+  /// @brief **Number of nodes.**
+  size_t nodes ();
+
+  ~lattice ();
+};
+}
+
+#endif
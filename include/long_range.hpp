@@ -0,0 +1,36 @@
+/// @file     long_range.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of the long-range coupling functions.
+/// @details  On a regular periodic grid the full power-law field h_i = sum_k J(r_ik)*sin(theta_k), with
+/// J(r) = 0.5/(r/ds)^alpha over all other nodes at minimum image distance r, is a circular convolution
+/// of sin(theta) with J on the columns x rows grid. The kernels compute it in O(N log N) with radix-2
+/// FFTs (fft.cl): forward transform of sin(theta) along rows and columns, product with the transform of
+/// J, inverse transform. J is even, so its transform is real: it is computed once on the host, scaled
+/// by 1/(columns*rows) so that the inverse transform needs no normalisation, and rebuilt only when
+/// alpha changes.
+#ifndef long_range_hpp
+#define long_range_hpp
+
+#include <vector>
+#include <cstddef>
+
+namespace sb
+{
+/// @brief **Power of two test.**
+bool               power_of_two (
+                                 size_t loc_n                                                        ///< Number.
+                                );
+
+/// @brief **Long-range coupling spectrum.**
+/// @details Computes the (real, scaled) 2D discrete Fourier transform of J = 0.5/(r/ds)^alpha on a
+/// periodic columns x rows grid of spacing "loc_spacing" (in units of ds), row by row
+/// (cell = row*columns + column), with J = 0 on the origin cell. Both sizes must be powers of two.
+std::vector<float> long_range_spectrum (
+                                        size_t loc_columns,                                          ///< Number of grid columns.
+                                        size_t loc_rows,                                             ///< Number of grid rows.
+                                        float  loc_spacing,                                          ///< Grid spacing (in units of ds).
+                                        float  loc_alpha                                             ///< Radial exponent.
+                                       );
+}
+
+#endif
@@ -0,0 +1,66 @@
+/// @file     partition.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of a "partition" class.
+/// @details  Domain decomposition of the CSR mesh for multi-device runs: the nodes are split into
+/// contiguous ranges of (roughly) equal edge count, one per device. A partition owns the CSR rows of
+/// its range and reads the theta of its ghost nodes (neighbours owned by other partitions): its device
+/// stores a theta slice of the owned nodes followed by the ghost nodes, and only the boundary nodes
+/// (owned nodes read by other partitions) and the ghost nodes are exchanged after each sweep (see
+/// halo.hpp). Contiguous ranges of a locality-preserving order (see reorder.hpp) keep the ghost layer
+/// thin. The mesh graph is assumed symmetric (every ghost node is a boundary node of its owner).
+#ifndef partition_hpp
+#define partition_hpp
+
+#include <vector>
+#include <cstddef>
+
+namespace sb
+{
+class partition                                                                                      /// @brief **Mesh partition.**
+{
+public:
+  size_t           begin;                                                                            ///< First owned node.
+  size_t           end;                                                                              ///< Last owned node + 1.
+  std::vector<int> ghost;                                                                            ///< Ghost nodes (sorted).
+  std::vector<int> boundary;                                                                         ///< Boundary nodes (sorted).
+
+  partition ();
+
+  /// @brief **Partition builder.**
+  /// @details Sets the owned node range of partition "loc_part" out of "loc_parts" (balanced by edge
+  /// count) and collects its ghost and boundary nodes.
+  void   split (
+                const std::vector<int>& loc_neighbour,                                               ///< CSR neighbour indices.
+                const std::vector<int>& loc_offset,                                                  ///< CSR neighbour offsets.
+                size_t                  loc_parts,                                                   ///< Number of partitions.
+                size_t                  loc_part                                                     ///< Partition index.
+               );
+
+  /// @brief **CSR slicer.**
+  /// @details Restricts the CSR arrays to the owned rows: offsets are rebased to the first owned edge,
+  /// neighbour indices are mapped to slice indices (owned node "begin + i" to "i", ghost node "g" to
+  /// "nodes () + g"). The per-edge array "loc_coupling" is sliced along.
+  void   slice (
+                std::vector<int>&   loc_neighbour,                                                   ///< CSR neighbour indices.
+                std::vector<int>&   loc_offset,                                                      ///< CSR neighbour offsets.
+                std::vector<float>& loc_coupling                                                     ///< Per-edge float array.
+               );
+
+  /// @brief **Number of owned nodes.**
+  size_t nodes ();
+
+  /// @brief **Slice size.**
+  /// @details Returns the number of owned and ghost nodes.
+  size_t size ();
+
+  /// @brief **Global node.**
+  /// @details Returns the global node of slice index "loc_index".
+  size_t node (
+               size_t loc_index                                                                      ///< Slice index.
+              );
+
+  ~partition ();
+};
+}
+
+#endif
@@ -0,0 +1,114 @@
+/// @file     profiler.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of a "profiler" class.
+/// @details  Named timing channels (kernels, host/device transfers, GL interop, file writes) with a
+/// rolling window of the last PROFILE_WINDOW samples each, plus derived rates (sweeps per second, node
+/// updates per second, rejection iterations per node) stored as ordinary channels. Statistics (mean,
+/// p50, p99) are shown in the HUD and written to a tab-separated timing log, one line per channel.
+/// The profiler is disabled (all calls return immediately) until the timing log is opened.
+/// All times are host wall-clock times (std::chrono). Neutrino does not expose the cl_event of a
+/// launch, so OpenCL event profiling is not available: when profiling, the callers launch every
+/// kernel blocking and time it on its own channel ("K0" to "K11"), as well as each read, write and
+/// GL interop step. Kernel times then include the launch overhead and the queue is drained after
+/// every kernel, so profiled runs are slower than unprofiled ones, which never wait.
+#ifndef profiler_hpp
+#define profiler_hpp
+
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <fstream>
+#include <cstddef>
+
+#define PROFILE_WINDOW 256                                                                           // Samples per channel (rolling window).
+#define PROFILE_FILE   "Timing_"                                                                     // Timing log file name (timestamp to be added).
+#define PROFILE_EXT    "tsv"                                                                         // Timing log file extension.
+
+namespace sb
+{
+class profiler                                                                                       /// @brief **Profiler.**
+{
+private:
+  std::map<std::string, size_t>                      index;                                          ///< Channel index by name.
+  std::vector<std::string>                           name;                                           ///< Channel names (first use order).
+  std::vector<std::vector<double> >                  sample;                                         ///< Channel samples (rolling window).
+  std::vector<size_t>                                count;                                          ///< Channel samples (total).
+  std::vector<std::chrono::steady_clock::time_point> start;                                          ///< Channel timer start.
+  std::ofstream                                      file;                                           ///< Timing log.
+  std::chrono::steady_clock::time_point              origin;                                         ///< Profiler creation time.
+  bool                                               enabled;                                        ///< "true" = profiling.
+
+  size_t channel (
+                  std::string loc_name                                                               // Channel name.
+                 );
+
+public:
+  profiler ();
+
+  /// @brief **Timing log opener.**
+  /// @details Creates the timing log and enables the profiler. Returns "false" if the file cannot be
+  /// created.
+  bool   open (
+               std::string loc_file_name                                                             ///< Timing log file name.
+              );
+
+  /// @brief **Profiling flag.**
+  bool   is_enabled ();
+
+  /// @brief **Timer start.**
+  void   begin (
+                std::string loc_name                                                                 ///< Channel name.
+               );
+
+  /// @brief **Timer stop.**
+  /// @details Adds the time elapsed since "begin" [us] to the channel.
+  void   end (
+              std::string loc_name                                                                   ///< Channel name.
+             );
+
+  /// @brief **Sample adder.**
+  /// @details Adds an arbitrary sample (e.g. a rate) to the channel.
+  void   add (
+              std::string loc_name,                                                                  ///< Channel name.
+              double      loc_value                                                                  ///< Sample.
+             );
+
+  /// @brief **Channel last sample.**
+  /// @details Last sample of the channel (0 if the channel has no samples).
+  double last (
+               std::string loc_name                                                                  ///< Channel name.
+              );
+
+  /// @brief **Channel mean.**
+  /// @details Mean of the rolling window (0 if the channel has no samples).
+  double mean (
+               std::string loc_name                                                                  ///< Channel name.
+              );
+
+  /// @brief **Channel percentile.**
+  /// @details Percentile "loc_p" (0 to 100) of the rolling window (0 if the channel has no samples).
+  double percentile (
+                     std::string loc_name,                                                           ///< Channel name.
+                     double      loc_p                                                               ///< Percentile [%].
+                    );
+
+  /// @brief **Uptime.**
+  /// @details Time elapsed since the profiler was created [us] (e.g. time to first sweep).
+  double uptime ();
+
+  /// @brief **Timing log writer.**
+  /// @details Writes one line per channel: step, channel, total samples, mean, p50, p99.
+  void   write (
+                size_t loc_step                                                                      ///< Step index.
+               );
+
+  /// @brief **Statistics printer.**
+  /// @details Prints mean, p50 and p99 of all channels, for the record.
+  void   print ();
+
+  ~profiler ();
+};
+}
+
+#endif
@@ -0,0 +1,63 @@
+/// @file     reorder.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of the node reordering functions.
+/// @details  Locality-aware node numbering for the CSR kernels: neighbour nodes get close indices, so
+/// that the gathers through the "neighbour" array hit fewer cache lines. An order is a permutation
+/// with "order[new] = old"; the per-node arrays are permuted with "permute()" and the CSR arrays with
+/// "permute_csr()". Exported data are mapped back to the original (mesh) order.
+#ifndef reorder_hpp
+#define reorder_hpp
+
+#include <vector>
+#include <cstddef>
+
+namespace sb
+{
+/// @brief **Reverse Cuthill-McKee order.**
+/// @details Breadth-first visit of each connected component from a minimum degree node, neighbours
+/// being visited by increasing degree, then reversed: reduces the bandwidth of the neighbour graph.
+std::vector<int> rcm_order (
+                            const std::vector<int>& loc_neighbour,                                   ///< CSR neighbour indices.
+                            const std::vector<int>& loc_offset                                       ///< CSR neighbour offsets.
+                           );
+
+/// @brief **Morton order.**
+/// @details Sorts nodes along a Z-order curve over their coordinates (16 bits per axis over the
+/// bounding box).
+std::vector<int> morton_order (
+                               const std::vector<float>& loc_x,                                      ///< Node "x" coordinates.
+                               const std::vector<float>& loc_y                                       ///< Node "y" coordinates.
+                              );
+
+/// @brief **CSR permutation.**
+/// @details Renumbers the CSR arrays according to "loc_order": the neighbours of the new node "i" are
+/// those of the old node "loc_order[i]", renumbered. The optional per-edge array "loc_edge" (e.g. edge
+/// lengths) is moved along.
+void             permute_csr (
+                              const std::vector<int>& loc_order,                                     ///< Order (order[new] = old).
+                              std::vector<int>&       loc_neighbour,                                 ///< CSR neighbour indices.
+                              std::vector<int>&       loc_offset,                                    ///< CSR neighbour offsets.
+                              std::vector<float>*     loc_edge                                       ///< Per-edge array (optional, nullptr = none).
+                             );
+
+/// @brief **Per-node permutation.**
+/// @details Permutes a per-node array according to "loc_order" (data[new] = data[old]).
+template <typename T>
+void permute (
+              const std::vector<int>& loc_order,                                                     ///< Order (order[new] = old).
+              std::vector<T>&         loc_data                                                       ///< Per-node array.
+             )
+{
+  std::vector<T> permuted (loc_order.size ());                                                       // Permuted array.
+  size_t         i;                                                                                  // Node index.
+
+  for(i = 0; i < loc_order.size (); i++)
+  {
+    permuted[i] = loc_data[loc_order[i]];                                                            // Moving node data...
+  }
+
+  loc_data.swap (permuted);                                                                          // Setting permuted array...
+}
+}
+
+#endif
@@ -0,0 +1,165 @@
+/// @file     snapshot.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of the binary snapshot classes.
+/// @details  A snapshot file is a stream of fixed-size records, each one holding the field of one trial:
+///
+///   [file header][node index][node x][node y] [record header][theta][RNG state] [record header]...
+///
+/// The file header identifies the mesh (number of nodes and a hash of its geometry and topology), the
+/// mesh block is stored once, then every record stores the step, trial, replica, a copy of the parameter
+/// array, theta as raw floats and (optionally) the random generator states of all nodes (the "theta"
+/// generator states of all nodes, then the "threshold" generator states of all nodes, 4 words each). All records have
+/// the same size, so that record "r" is found at a fixed offset and the whole file can be mapped in
+/// memory for analysis. Data are stored in the native byte order.
+#ifndef snapshot_hpp
+#define snapshot_hpp
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstddef>
+
+#define SNAPSHOT_MAGIC      "SBSNAP"                                                                 // Snapshot file magic string.
+#define SNAPSHOT_VERSION    1                                                                        // Snapshot file format version.
+#define SNAPSHOT_PARAMETERS 16                                                                       // Number of stored parameters.
+#define SNAPSHOT_RNG        8                                                                        // Random generator state words per node.
+#define SNAPSHOT_EXT        "snap"                                                                   // Snapshot file extension.
+
+namespace sb
+{
+struct snapshot_file_header                                                                          /// @brief **Snapshot file header.**
+{
+  char     magic[8];                                                                                 ///< Magic string.
+  uint32_t version;                                                                                  ///< Format version.
+  uint32_t nodes;                                                                                    ///< Number of nodes.
+  uint64_t mesh_hash;                                                                                ///< Mesh hash.
+  uint32_t rng_words;                                                                                ///< Random generator state words per node (0 = none).
+  uint32_t reserved;                                                                                 ///< Reserved (padding).
+};
+
+struct snapshot_record_header                                                                        /// @brief **Snapshot record header.**
+{
+  uint64_t step;                                                                                     ///< Step (since start).
+  uint32_t trial;                                                                                    ///< Trial index.
+  uint32_t replica;                                                                                  ///< Replica index.
+  float    parameter[SNAPSHOT_PARAMETERS];                                                           ///< Parameters.
+};
+
+/// @brief **Mesh hash.**
+/// @details 64-bit FNV-1a hash of the node coordinates and of the CSR neighbour arrays: a snapshot
+/// can only be loaded on a mesh with the same hash.
+uint64_t mesh_hash (
+                    const std::vector<float>& loc_x,                                                 ///< Node "x" coordinates.
+                    const std::vector<float>& loc_y,                                                 ///< Node "y" coordinates.
+                    const std::vector<int>&   loc_neighbour,                                         ///< CSR neighbour indices.
+                    const std::vector<int>&   loc_offset                                             ///< CSR neighbour offsets.
+                   );
+
+/// @brief **File hash.**
+/// @details 64-bit FNV-1a hash of the whole content of a file (e.g. a GMSH mesh), read in large
+/// blocks. Returns 0 if the file cannot be read.
+uint64_t file_hash (
+                    std::string loc_file_name                                                        ///< File name.
+                   );
+
+/// @brief **Snapshot file name check.**
+/// @details Returns "true" if the file name has the snapshot extension.
+bool     is_snapshot (
+                      std::string loc_file_name                                                      ///< File name.
+                     );
+
+class snapshot_writer                                                                                /// @brief **Snapshot writer.**
+{
+private:
+  std::ofstream file;                                                                                ///< Snapshot file.
+  uint32_t      nodes;                                                                               ///< Number of nodes.
+  uint32_t      rng_words;                                                                           ///< Random generator state words per node.
+
+public:
+  snapshot_writer ();
+
+  /// @brief **Snapshot file opener.**
+  /// @details Creates the file and writes the file header and the mesh block.
+  void open (
+             std::string               loc_file_name,                                                ///< File name (with extension).
+             uint64_t                  loc_mesh_hash,                                                ///< Mesh hash.
+             const std::vector<int>&   loc_index,                                                    ///< Node indices.
+             const std::vector<float>& loc_x,                                                        ///< Node "x" coordinates.
+             const std::vector<float>& loc_y,                                                        ///< Node "y" coordinates.
+             bool                      loc_rng                                                       ///< "true" = store random generator state.
+            );
+
+  bool is_open ();
+
+  /// @brief **Snapshot record writer.**
+  /// @details Appends a record. All pointers point to the first node of the field: the random
+  /// generator states (4 words per node each) are ignored if the file has no RNG state.
+  void write (
+              uint64_t                  loc_step,                                                    ///< Step.
+              uint32_t                  loc_trial,                                                   ///< Trial index.
+              uint32_t                  loc_replica,                                                 ///< Replica index.
+              const std::vector<float>& loc_parameter,                                               ///< Parameters.
+              const float*              loc_theta,                                                   ///< Theta.
+              const int*                loc_rng_theta,                                               ///< Random generator state (theta).
+              const int*                loc_rng_threshold                                            ///< Random generator state (threshold).
+             );
+
+  void close ();
+
+  ~snapshot_writer ();
+};
+
+class snapshot_reader                                                                                /// @brief **Snapshot reader.**
+{
+private:
+  const char*          base;                                                                         ///< Mapped file.
+  size_t               size;                                                                         ///< File size [bytes].
+  std::vector<char>    buffer;                                                                       ///< File buffer (no memory mapping).
+  snapshot_file_header header;                                                                       ///< File header.
+  size_t               data_offset;                                                                  ///< First record offset [bytes].
+  size_t               record_size;                                                                  ///< Record size [bytes].
+
+public:
+  snapshot_reader ();
+
+  /// @brief **Snapshot file opener.**
+  /// @details Maps the file in memory (read only). Returns "false" if the file cannot be opened.
+  /// Exits on malformed files.
+  bool                          open (
+                                      std::string loc_file_name                                      ///< File name (with extension).
+                                     );
+
+  size_t                        nodes ();
+
+  uint64_t                      mesh_hash ();
+
+  bool                          has_rng ();
+
+  size_t                        records ();
+
+  const int*                    index ();
+
+  const float*                  x ();
+
+  const float*                  y ();
+
+  const snapshot_record_header* record (
+                                        size_t loc_record                                            ///< Record index.
+                                       );
+
+  const float*                  theta (
+                                       size_t loc_record                                             ///< Record index.
+                                      );
+
+  const int*                    rng (
+                                     size_t loc_record                                               ///< Record index.
+                                    );
+
+  void                          close ();
+
+  ~snapshot_reader ();
+};
+}
+
+#endif
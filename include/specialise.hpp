@@ -0,0 +1,42 @@
+/// @file     specialise.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of the kernel specialisation function.
+/// @details  The run constants of the parameter array (theta slice size, CSR rows and their first node,
+/// halo boundary size, sampler, random generator, structured grid, long-range mode, compact neighbour
+/// indices, energy reduction, ring and reduction sizes, m_max) never change during a headless run:
+/// they are passed to the OpenCL JIT compiler as "-D" build options, so that the kernels index with
+/// compile-time constants and drop the branches of the unused sampler, random generator, coupling
+/// mode and neighbour index format. The interactive application changes m_max at run time, so it
+/// leaves it to the parameter array, with the fields, temperature and decay threshold. Kernels built
+/// without options read all values from the parameter array (see utilities.cl), where counts are
+/// exact only up to 2^24 (float mantissa): the counts are therefore passed to the build options as
+/// exact integers, and larger meshes need the specialised kernels. No program binaries are cached
+/// by the application (Neutrino builds every program from source and exposes no program binary):
+/// the kernels are compiled at every launch, unless the OpenCL driver caches them itself.
+#ifndef specialise_hpp
+#define specialise_hpp
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <cstddef>
+
+#define SPECIALISE_EXACT 16777216                                                                    // Largest count exact in the float parameter array (2^24).
+
+namespace sb
+{
+/// @brief **Kernel build options.**
+/// @details Builds the "-D" options from the parameter array (to be set after all run constants),
+/// taking the run constants listed in "loc_exact" (parameter index, value: node and row counts) from
+/// their exact integer values and leaving the parameters listed in "loc_runtime" (parameter index)
+/// to the parameter array. The string is deterministic for a given run, so that a driver program
+/// cache keyed by source and options, where the OpenCL implementation has one, can be hit.
+std::string kernel_options (
+                            const std::vector<float>&       loc_parameter,                           ///< Parameter array.
+                            const std::map<size_t, size_t>& loc_exact,                               ///< Exact run constants (by parameter index).
+                            const std::set<size_t>&         loc_runtime                              ///< Runtime parameters (by parameter index).
+                           );
+}
+
+#endif
@@ -0,0 +1,121 @@
+/// @file     spin_bubble.hpp
+/// @date     16OCT2026
+/// @brief    Spin-bubble common definitions.
+/// @details  Mesh tags, physical defaults, file names and paths shared by all Spin-bubble drivers
+/// (interactive and headless).
+#ifndef spin_bubble_hpp
+#define spin_bubble_hpp
+
+#define SURFACE_TAG   1                                                                              // Surface tag.
+#define BORDER_TAG    9                                                                              // Border tag.
+#define SIDE_X_TAG    10                                                                             // Side "x" tag.
+#define SIDE_Y_TAG    11                                                                             // Side "y" tag.
+#define CURVE_DIM     1                                                                              // Curve dimension.
+#define SURFACE_DIM   2                                                                              // Surface dimension.
+#define BORDER_DIM    1                                                                              // Border dimension.
+#define SIDE_X_DIM    1                                                                              // Side "x" dimension.
+#define SIDE_Y_DIM    1                                                                              // Side "y" dimension.
+#define DS            0.05f                                                                          // vacuum elementary cell side.
+#define EPSILON       0.01f                                                                          // Tolerance for cell detection.
+#define CELL_VERTICES 4                                                                              // Number of vertices per elementary cell.
+
+#define M_MAX         1000                                                                           // Maximum allowed number of rejections.
+#define HX_INIT       0.8f                                                                           // Longitudinal magnetic field.
+#define HZ_INIT       0.01f                                                                          // Transverse magnetic field.
+#define T_INIT        0.1f                                                                           // Temperature.
+#define ALPHA_INIT    1.0f                                                                           // Radial exponent.
+#define THETA_INIT    M_PI                                                                           // Theta angle.
+#define TRIALS_INIT   100                                                                            // Auto-trials.
+#define DATA_POINTS   100                                                                            // Data points for energy profile.
+#define VERBOSE_INIT  false                                                                          // Per-node startup diagnostics.
+#define PROFILE_INIT  false                                                                          // Kernel profiling (blocking launches, timing log).
+
+#define REDUCTION_ITEMS  4096                                                                        // Work-items of the first reduction stage (K3).
+#define GRID_TILE        16                                                                          // Structured kernel work-group side (TILE_SIZE of thekernel_6.cl).
+#define OBSERVABLE_DEPTH 64                                                                          // Observable ring buffer depth [steps].
+#define OBSERVABLES      6                                                                           // Number of observables per ring slot (must match utilities.cl).
+#define OBS_SZ           0                                                                           // z-spin summation.
+#define OBS_SZ2          1                                                                           // z-spin square summation.
+#define OBS_OVERFLOW     2                                                                           // Rejection sampling overflow summation.
+#define OBS_STEP         3                                                                           // Replica trial step (0 = not running).
+#define OBS_ENERGY       4                                                                           // Energy summation.
+#define OBS_ITERATIONS   5                                                                           // Rejection sampling iterations summation.
+
+#define REPLICAS_INIT    1                                                                           // Number of replicas.
+#define REPLICA_RUNNING  0                                                                           // Replica running a trial (must match utilities.cl).
+#define REPLICA_DONE     1                                                                           // Replica trial done (waiting for download).
+#define REPLICA_IDLE     2                                                                           // Replica without trials left.
+
+#define DECAY_UNKNOWN    0                                                                           // Decay side unknown, in replica.w (must match utilities.cl).
+#define DECAY_BELOW      1                                                                           // <sz> started below the decay threshold.
+#define DECAY_ABOVE      2                                                                           // <sz> started above the decay threshold.
+#define DECAY_EVENT      3                                                                           // <sz> crossed the decay threshold (trial ended by decay).
+#define DECAY_INIT       true                                                                        // Decay detection (auto-restart on decay).
+#define DECAY_SZ_INIT    0.5f                                                                        // Decay threshold on <sz>.
+#define TARGET_ERROR_INIT 0.0f                                                                       // Target standard error of <sz> per trial (0 = fixed trial length).
+
+#define RNG_XOSHIRO      0                                                                           // xoshiro128++ random generator (must match utilities.cl).
+#define RNG_PHILOX       1                                                                           // Philox4x32-10 random generator (counter-based).
+#define RNG_INIT         RNG_PHILOX                                                                  // Random generator mode.
+
+#define SAMPLER_REJECTION 0                                                                          // Rejection sampler (must match utilities.cl).         
+#define SAMPLER_HEATBATH  1                                                                          // Heat-bath sampler (exact von Mises draw).
+#define SAMPLER_INIT      SAMPLER_REJECTION                                                          // Single-site sampler.
+
+#ifdef __linux__
+  #define SHADER_HOME "../../Code/shader/"                                                           // Linux OpenGL shaders directory.
+  #define KERNEL_HOME "../../Code/kernel/"                                                           // Linux OpenCL kernels directory.
+  #define GMSH_HOME   "../../Code/mesh/"                                                             // Linux GMSH mesh directory.
+  #define LOG_HOME    "../../log/"                                                                   // Linux log directory.
+  #define DLOAD_HOME  "../../log/"                                                                   // Linux log directory.
+  #define ULOAD_HOME  "../../log/"                                                                   // Linux log directory.
+#endif
+
+#ifdef WIN32
+  #define SHADER_HOME "..\\..\\Code\\shader\\"                                                       // Windows OpenGL shaders directory.
+  #define KERNEL_HOME "..\\..\\Code\\kernel\\"                                                       // Windows OpenCL kernels directory.
+  #define GMSH_HOME   "..\\..\\Code\\mesh\\"                                                         // Windows GMSH mesh directory.
+  #define LOG_HOME    "..\\..\\log\\"                                                                // Windows log directory.
+  #define DLOAD_HOME  "..\\..\\log\\"                                                                // Windows log directory.
+  #define ULOAD_HOME  "..\\..\\log\\"                                                                // Windows log directory.
+#endif
+
+#define KERNEL_0      "thekernel_0.cl"                                                               // OpenCL kernel source.
+#define KERNEL_1      "thekernel_1.cl"                                                               // OpenCL kernel source.
+#define KERNEL_2      "thekernel_2.cl"                                                               // OpenCL kernel source.
+#define KERNEL_3      "thekernel_3.cl"                                                               // OpenCL kernel source.
+#define KERNEL_4      "thekernel_4.cl"                                                               // OpenCL kernel source.
+#define KERNEL_5      "thekernel_5.cl"                                                               // OpenCL kernel source.
+#define KERNEL_6      "thekernel_6.cl"                                                               // OpenCL kernel source.
+#define KERNEL_7      "thekernel_7.cl"                                                               // OpenCL kernel source.
+#define KERNEL_8      "thekernel_8.cl"                                                               // OpenCL kernel source.
+#define KERNEL_9      "thekernel_9.cl"                                                               // OpenCL kernel source.
+#define KERNEL_10     "thekernel_10.cl"                                                              // OpenCL kernel source.
+#define KERNEL_11     "thekernel_11.cl"                                                              // OpenCL kernel source.
+#define UTILITIES     "utilities.cl"                                                                 // OpenCL utilities source.
+#define ANGLE         "angle.cl"                                                                     // OpenCL 16-bit fixed-point angles source.
+#define HEATBATH      "heatbath.cl"                                                                  // OpenCL heat-bath draw source.
+#define METROPOLIS    "metropolis.cl"                                                                // OpenCL Metropolis update source.
+#define FFT           "fft.cl"                                                                       // OpenCL FFT source.
+#define MESH_FILE     "Periodic_square.msh"                                                          // GMSH mesh.
+#define MESH          GMSH_HOME MESH_FILE                                                            // GMSH mesh (full path).
+#define LOG_FILE      "Data_"                                                                        // Log file name.
+#define LOG_HEAD      "Spin bubble."                                                                 // Log file header.
+#define LOG_EXT       "dat"                                                                          // Log file extension.
+#define LOG           LOG_HOME LOG_FILE                                                              // Log file name (full name, timestamp and extension to be added).
+#define DECAY_FILE    "Decay_"                                                                       // Decay log file name.
+#define DLOAD_FILE    "Download_"                                                                    // Download file name.
+#define DLOAD_HEAD    "Spin bubble."                                                                 // Download file header.
+#define DLOAD_EXT     "dat"                                                                          // Download file extension.
+#define DLOAD         DLOAD_HOME DLOAD_FILE                                                          // Download file name (full name, timestamp and extension to be added).
+#define ULOAD_FILE    "Upload"                                                                       // Upload file name.
+#define ULOAD_HEAD    "Spin bubble."                                                                 // Upload file header.
+#define ULOAD_EXT     "dat"                                                                          // Upload file extension.
+#define ULOAD         ULOAD_HOME ULOAD_FILE                                                          // Upload file name (full name, timestamp and extension to be added).
+#define FRAME_RATE    60.0                                                                           // Render rate cap (sweeps fill the rest of each frame) [Hz].
+#define PROFILE_INTERVAL 100                                                                         // Timing log interval (GUI) [frames].
+#define CKPT_FILE     "Checkpoint"                                                                   // Checkpoint file name.
+#define CKPT_EXT      "ckpt"                                                                         // Checkpoint file extension.
+#define CKPT          LOG_HOME CKPT_FILE "." CKPT_EXT                                                // Checkpoint file name (full name).
+
+#endif
@@ -0,0 +1,104 @@
+/// @file     statistics.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of a "statistics" class.
+/// @details  Streaming blocking (binning) analysis of a correlated time series, in O(log n) memory:
+/// level 0 holds the samples, level l the averages of 2^l consecutive samples. Each level keeps only
+/// the sum and the sum of squares of its blocks, plus one block waiting for its pair. The standard
+/// error of the mean at level l grows with l until the blocks are longer than the correlation time,
+/// then stays on a plateau. The plateau is the first level, among those with at least STAT_MIN_BLOCKS
+/// blocks, whose block length B = 2^l satisfies B^3 > 2*n*(2*tau_l)^2, with 2*tau_l the ratio of the
+/// level and naive variances of the mean (optimal block length of Lee, Kent and Needs, 2011): blocks
+/// shorter than that are still correlated, longer ones only add noise to the error. If no level
+/// passes yet, the series is too short and the largest level error is returned as a lower bound.
+/// The integrated autocorrelation time follows from the ratio of the blocked and naive variances,
+/// tau = 0.5*(error/naive error)^2, and the effective sample size is n/(2*tau).
+#ifndef statistics_hpp
+#define statistics_hpp
+
+#include <vector>
+#include <cstddef>
+
+#define STAT_LEVELS     40                                                                           // Blocking levels (blocks of up to 2^39 samples).
+#define STAT_MIN_BLOCKS 32                                                                           // Minimum number of blocks of a level in the error estimate.
+#define STAT_FILE       "Statistics_"                                                                // Statistics log file name (timestamp to be added).
+
+namespace sb
+{
+class statistics                                                                                     /// @brief **Streaming statistics.**
+{
+private:
+  std::vector<double> sum;                                                                           ///< Block summation, per level.
+  std::vector<double> sum2;                                                                          ///< Block square summation, per level.
+  std::vector<double> blocks;                                                                        ///< Number of blocks, per level.
+  std::vector<double> pending;                                                                       ///< Block waiting for its pair, per level.
+  std::vector<double> waiting;                                                                       ///< "1" = pending block set, per level.
+
+  double variance (
+                   size_t loc_level                                                                  // Blocking level.
+                  );
+
+  double level_error (
+                      size_t loc_level                                                               // Blocking level.
+                     );
+
+  size_t plateau_level ();
+
+public:
+  statistics ();
+
+  /// @brief **Sample accumulator.**
+  /// @details Adds a sample to level 0 and carries the completed block pairs up the levels.
+  void                add (
+                           double loc_sample                                                         ///< Sample.
+                          );
+
+  /// @brief **Reset.**
+  void                clear ();
+
+  double              samples ();
+
+  double              mean ();
+
+  /// @brief **Naive standard error.**
+  /// @details Standard error of the mean with the samples taken as independent.
+  double              naive_error ();
+
+  /// @brief **Standard error.**
+  /// @details Blocked standard error of the mean at the plateau level (largest level error if the
+  /// plateau is not reached yet).
+  double              error ();
+
+  /// @brief **Plateau test.**
+  /// @details Returns "true" when a blocking level satisfies the optimal block length criterion.
+  bool                plateau ();
+
+  /// @brief **Integrated autocorrelation time.**
+  /// @details In units of samples (0.5 for independent samples).
+  double              tau ();
+
+  /// @brief **Effective sample size.**
+  double              effective_samples ();
+
+  /// @brief **Convergence test.**
+  /// @details Returns "true" when the blocking plateau is reached, the standard error is within
+  /// "loc_target" and the series spans at least STAT_MIN_BLOCKS autocorrelation times (so that the
+  /// error estimate can be trusted).
+  bool                converged (
+                                 double loc_target                                                   ///< Target standard error.
+                                );
+
+  /// @brief **State getter.**
+  /// @details Returns the accumulator state, for checkpoints.
+  std::vector<double> state ();
+
+  /// @brief **State setter.**
+  /// @details Restores a state returned by "state()".
+  void                restore (
+                               const std::vector<double>& loc_state                                  ///< Accumulator state.
+                              );
+
+  ~statistics ();
+};
+}
+
+#endif
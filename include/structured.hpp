@@ -0,0 +1,36 @@
+/// @file     structured.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of the structured grid detection function.
+/// @details  A mesh is a regular periodic grid when its nodes sit on the cells of a columns x rows
+/// array, every node links exactly to its 4 axial (or 4 axial and 4 diagonal) neighbours with periodic
+/// wrap, and all axial edges have the same length L (diagonal edges sqrt(2)*L). On such meshes the
+/// neighbours are implicit and the update can run on the structured stencil kernel instead of the CSR
+/// one, with only two distinct couplings.
+#ifndef structured_hpp
+#define structured_hpp
+
+#include <vector>
+#include <cstddef>
+
+namespace sb
+{
+/// @brief **Structured grid detection.**
+/// @details Returns "true" if the mesh is a regular periodic grid: in that case "loc_grid" lists the
+/// node of each grid cell, row by row (cell = row*columns + column), followed by the CSR index of an
+/// axial edge and of a diagonal edge (the axial one again for 4-neighbour stencils), from which the
+/// two couplings can be read in the coupling table.
+bool structured_grid (
+                      const std::vector<float>& loc_x,                                               ///< Node "x" coordinates.
+                      const std::vector<float>& loc_y,                                               ///< Node "y" coordinates.
+                      const std::vector<int>&   loc_neighbour,                                       ///< CSR neighbour indices.
+                      const std::vector<int>&   loc_offset,                                          ///< CSR neighbour offsets.
+                      const std::vector<float>& loc_length,                                          ///< Edge lengths.
+                      float                     loc_ds,                                              ///< Grid spacing (tolerance scale).
+                      std::vector<int>&         loc_grid,                                            ///< Node of each grid cell.
+                      size_t&                   loc_columns,                                         ///< Number of grid columns.
+                      size_t&                   loc_rows,                                            ///< Number of grid rows.
+                      size_t&                   loc_stencil                                          ///< Neighbours per node (4 or 8).
+                     );
+}
+
+#endif
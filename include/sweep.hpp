@@ -0,0 +1,177 @@
+/// @file     sweep.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of a "sweep" class.
+/// @details  Parameter sweep over a (T, Hx, Hz, alpha) grid. The points are grouped in batches of equal
+/// (Hx, Hz, alpha), one point per temperature: the temperatures of a batch run side by side on the
+/// replicas (per-replica temperature), while the fields and the coupling table are shared and change
+/// only between batches. Batches follow a serpentine order, so that consecutive batches are
+/// neighbouring grid points and each point can warm-start from the last theta of the same temperature
+/// in the previous batch. Each point runs "trials" trials, numbered point by point; a run of "jobs"
+/// processes (one per device) splits the batches into contiguous blocks, job "job" taking its own.
+/// The mean <sz> (blocking analysis, see statistics.hpp) and energy per node of each point are
+/// accumulated over the trial steps after "burn".
+#ifndef sweep_hpp
+#define sweep_hpp
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+#include "statistics.hpp"
+
+#define SWEEP_FILE "Sweep_"                                                                          // Sweep result table file name (timestamp to be added).
+
+namespace sb
+{
+class sweep                                                                                          /// @brief **Parameter sweep.**
+{
+private:
+  std::vector<float>  T_axis;                                                                        ///< Temperature values.
+  std::vector<float>  Hx_axis;                                                                       ///< Longitudinal magnetic field values.
+  std::vector<float>  Hz_axis;                                                                       ///< Transverse magnetic field values.
+  std::vector<float>  alpha_axis;                                                                    ///< Radial exponent values.
+  size_t              repeats;                                                                       ///< Trials per point.
+  size_t              burn;                                                                          ///< Trial steps discarded from the averages.
+  size_t              first;                                                                         ///< First batch of this job.
+  size_t              last;                                                                          ///< Last batch of this job (excluded).
+  std::vector<statistics> sz_stat;                                                                   ///< <sz> statistics.
+  std::vector<double> energy_sum;                                                                    ///< Energy per node summation.
+  std::vector<size_t> finished;                                                                      ///< Number of finished trials.
+  std::vector<size_t> decays;                                                                        ///< Number of decayed trials.
+
+  size_t axis (
+               size_t loc_batch,                                                                     // Batch index.
+               size_t loc_axis                                                                       // Axis (0 = Hx, 1 = Hz, 2 = alpha).
+              );
+
+public:
+  /// @brief **Class constructor.**
+  /// @details Sets the grid axes (lists of values, an empty list standing for the single value
+  /// "loc_default") and the batches of job "loc_job" out of "loc_jobs".
+  sweep (
+         std::vector<std::string> loc_T,                                                             ///< Temperature values.
+         std::vector<std::string> loc_Hx,                                                            ///< Longitudinal magnetic field values.
+         std::vector<std::string> loc_Hz,                                                            ///< Transverse magnetic field values.
+         std::vector<std::string> loc_alpha,                                                         ///< Radial exponent values.
+         std::vector<float>       loc_default,                                                       ///< Default (T, Hx, Hz, alpha).
+         size_t                   loc_repeats,                                                       ///< Trials per point.
+         size_t                   loc_burn,                                                          ///< Trial steps discarded from the averages.
+         size_t                   loc_jobs,                                                          ///< Number of jobs.
+         size_t                   loc_job                                                            ///< Job index.
+        );
+
+  /// @brief **Number of points.**
+  /// @details Returns the number of grid points of all jobs.
+  size_t points ();
+
+  /// @brief **Number of trials.**
+  /// @details Returns the number of trials of this job.
+  size_t trials ();
+
+  /// @brief **Number of temperatures.**
+  /// @details Returns the number of points per batch.
+  size_t temperatures ();
+
+  /// @brief **Trial point.**
+  /// @details Returns the grid point of trial "loc_trial" of this job.
+  size_t point (
+                size_t loc_trial                                                                     ///< Trial index (this job).
+               );
+
+  /// @brief **Point batch.**
+  size_t batch (
+                size_t loc_point                                                                     ///< Point index.
+               );
+
+  /// @brief **Batch end.**
+  /// @details Returns the index of the first trial of this job after the batch of trial "loc_trial".
+  size_t batch_end (
+                    size_t loc_trial                                                                 ///< Trial index (this job).
+                   );
+
+  /// @brief **Point rung.**
+  /// @details Returns the temperature index of a point (the replica slot it warm-starts from).
+  size_t rung (
+               size_t loc_point                                                                      ///< Point index.
+              );
+
+  float  T (
+            size_t loc_point                                                                         ///< Point index.
+           );
+
+  float  Hx (
+             size_t loc_point                                                                        ///< Point index.
+            );
+
+  float  Hz (
+             size_t loc_point                                                                        ///< Point index.
+            );
+
+  float  alpha (
+                size_t loc_point                                                                     ///< Point index.
+               );
+
+  /// @brief **Sample accumulator.**
+  /// @details Adds the observables of trial step "loc_step" of a point, unless within the burn-in.
+  void   add (
+              size_t loc_point,                                                                      ///< Point index.
+              size_t loc_step,                                                                       ///< Trial step.
+              float  loc_sz,                                                                         ///< Average z-spin.
+              float  loc_energy                                                                      ///< Energy per node.
+             );
+
+  /// @brief **Trial accumulator.**
+  /// @details Counts a finished trial of a point.
+  void   finish (
+                 size_t loc_point,                                                                   ///< Point index.
+                 bool   loc_decayed                                                                  ///< "true" = trial decayed.
+                );
+
+  /// @brief **Point range.**
+  /// @details Returns the first point of this job and the first point after it.
+  size_t first_point ();
+
+  size_t last_point ();
+
+  size_t trials (
+                 size_t loc_point                                                                    ///< Point index.
+                );
+
+  /// @brief **Average z-spin.**
+  float  sz (
+             size_t loc_point                                                                        ///< Point index.
+            );
+
+  /// @brief **Average z-spin standard error.**
+  /// @details Blocked standard error of the mean over all samples of a point.
+  float  sz_stderr (
+                    size_t loc_point                                                                 ///< Point index.
+                   );
+
+  /// @brief **Average z-spin autocorrelation time.**
+  /// @details Integrated autocorrelation time of <sz> [steps].
+  float  sz_tau (
+                 size_t loc_point                                                                    ///< Point index.
+                );
+
+  /// @brief **Average z-spin effective samples.**
+  float  sz_samples (
+                     size_t loc_point                                                                ///< Point index.
+                    );
+
+  /// @brief **Average energy per node.**
+  float  energy (
+                 size_t loc_point                                                                    ///< Point index.
+                );
+
+  /// @brief **Decay fraction.**
+  /// @details Fraction of the finished trials of a point that decayed.
+  float  decayed (
+                  size_t loc_point                                                                   ///< Point index.
+                 );
+
+  ~sweep ();
+};
+}
+
+#endif
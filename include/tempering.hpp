@@ -0,0 +1,83 @@
+/// @file     tempering.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of a "tempering" class.
+/// @details  Parallel tempering (replica exchange): K replicas run at the temperatures of a geometric
+/// ladder T_1 < ... < T_K. Neighbour rungs periodically attempt to swap their replicas, with the
+/// Metropolis acceptance probability min(1, exp((1/T_k - 1/T_k+1)*(E_a - E_b))). Temperatures are
+/// exchanged instead of configurations, so that only the per-replica temperature array has to be
+/// written back to the device.
+#ifndef tempering_hpp
+#define tempering_hpp
+
+#include <vector>
+#include <random>
+#include <string>
+#include <cstddef>
+
+namespace sb
+{
+class tempering                                                                                      /// @brief **Parallel tempering.**
+{
+private:
+  std::vector<float>  ladder;                                                                        ///< Temperature ladder (ascending).
+  std::vector<size_t> rung;                                                                          ///< Replica at each rung.
+  std::vector<size_t> attempts;                                                                      ///< Swap attempts between rung "k" and "k + 1".
+  std::vector<size_t> accepts;                                                                       ///< Accepted swaps between rung "k" and "k + 1".
+  std::mt19937        generator;                                                                     ///< Random generator.
+  size_t              parity;                                                                        ///< Rung pair parity (alternating even/odd pairs).
+
+public:
+  /// @brief **Class constructor.**
+  /// @details Builds a geometric ladder of "loc_replicas" temperatures between "loc_T_min" and
+  /// "loc_T_max", replica "k" starting at rung "k".
+  tempering (
+             float        loc_T_min,                                                                 ///< Lowest temperature.
+             float        loc_T_max,                                                                 ///< Highest temperature.
+             size_t       loc_replicas,                                                              ///< Number of replicas.
+             unsigned int loc_seed                                                                   ///< Random seed.
+            );
+
+  /// @brief **Replica temperatures.**
+  /// @details Sets the current temperature of each replica.
+  void        temperature (
+                           std::vector<float>& loc_temperature                                       ///< Replica temperatures.
+                          );
+
+  /// @brief **Swap attempt.**
+  /// @details Attempts to swap the replicas of all even (or odd, alternating at each call) neighbour
+  /// rung pairs, given the current energy of each replica, then updates the replica temperatures.
+  /// Returns the number of accepted swaps.
+  size_t      swap (
+                    const std::vector<float>& loc_energy,                                            ///< Replica energies.
+                    std::vector<float>&       loc_temperature                                        ///< Replica temperatures.
+                   );
+
+  /// @brief **Acceptance ratio.**
+  /// @details Returns the fraction of accepted swaps between rung "loc_k" and "loc_k + 1".
+  float       acceptance (
+                          size_t loc_k                                                               ///< Rung index.
+                         );
+
+  /// @brief **Rung temperature.**
+  float       rung_temperature (
+                                size_t loc_k                                                         ///< Rung index.
+                               );
+
+  size_t      rungs ();
+
+  /// @brief **State getter.**
+  /// @details Returns the ladder state (replica at each rung, swap counters, pair parity and random
+  /// generator state) as text, for checkpoints.
+  std::string state ();
+
+  /// @brief **State setter.**
+  /// @details Restores a ladder state returned by "state()".
+  void        restore (
+                       std::string loc_state                                                         ///< Ladder state.
+                      );
+
+  ~tempering ();
+};
+}
+
+#endif
@@ -0,0 +1,61 @@
+/// @file     topology.hpp
+/// @date     16OCT2026
+/// @brief    Declaration of a "topology" class.
+/// @details  Processed mesh topology (node indices and coordinates, CSR neighbours, side and border
+/// nodes) as produced by the GMSH mesh processing. It is cached to a binary file keyed by the hash of
+/// the mesh file, so that later runs on the same mesh skip the GMSH processing altogether: loading the
+/// cache is a handful of bulk reads.
+#ifndef topology_hpp
+#define topology_hpp
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#define TOPOLOGY_FILE "Topology_"                                                                    // Topology cache file name (mesh hash to be added).
+#define TOPOLOGY_EXT  "topo"                                                                         // Topology cache file extension.
+
+namespace sb
+{
+class topology                                                                                       /// @brief **Mesh topology.**
+{
+public:
+  std::vector<int>   node;                                                                           ///< Node indices.
+  std::vector<float> position;                                                                       ///< Node coordinates (x, y, z, w per node).
+  std::vector<int>   neighbour;                                                                      ///< CSR neighbour indices.
+  std::vector<int>   offset;                                                                         ///< CSR neighbour offsets.
+  std::vector<int>   border;                                                                         ///< Nodes on border.
+  uint64_t           side_x_nodes;                                                                   ///< Number of nodes along "x" side.
+  uint64_t           side_y_nodes;                                                                   ///< Number of nodes along "y" side.
+  uint64_t           elements;                                                                       ///< Number of element vertices.
+  uint64_t           groups;                                                                         ///< Number of group vertices.
+
+  topology ();
+
+  /// @brief **Cache file name.**
+  /// @details Returns "loc_directory" + "Topology_<hash>.topo", the hash being in hexadecimal.
+  static std::string file_name (
+                                std::string loc_directory,                                           ///< Cache directory.
+                                uint64_t    loc_hash                                                 ///< Mesh file hash.
+                               );
+
+  /// @brief **Cache loader.**
+  /// @details Loads the topology from "loc_file_name". Returns "false" if the file does not exist or
+  /// was built from a mesh file with a different hash.
+  bool               load (
+                           std::string loc_file_name,                                                ///< Cache file name.
+                           uint64_t    loc_hash                                                      ///< Mesh file hash.
+                          );
+
+  /// @brief **Cache writer.**
+  void               save (
+                           std::string loc_file_name,                                                ///< Cache file name.
+                           uint64_t    loc_hash                                                      ///< Mesh file hash.
+                          );
+
+  ~topology ();
+};
+}
+
+#endif